@@ -21,9 +21,20 @@ using worker_finished = atom_constant<atom("wof")>;
 using finish_worker = atom_constant<atom("fiw")>;
 using dispatcher_finished = atom_constant<atom("dif")>;
 using assign_id = atom_constant<atom("assi")>;
+using execute_evolution = atom_constant<atom("exevo")>;
+using collect_statistics = atom_constant<atom("costat")>;
+using report_load = atom_constant<atom("relo")>;
+using rebalance_population = atom_constant<atom("rebal")>;
 
 // Atoms used by grid model actors
 using execute_computation = atom_constant<atom("excomp")>;
+using collect_partition = atom_constant<atom("copart")>;
+
+// Atoms used by cellular model actors
+using receive_halo = atom_constant<atom("rehalo")>;
+
+// Atoms used by dispatchers of global and grid model actors
+using check_stragglers = atom_constant<atom("chstr")>;
 
 // Atoms used by reporter actors
 using init_reporter = atom_constant<atom("ir")>;
@@ -33,6 +44,7 @@ using report_population = atom_constant<atom("repo")>;
 using report_new_line = atom_constant<atom("renl")>;
 using note_start = atom_constant<atom("nst")>;
 using note_end = atom_constant<atom("nen")>;
+using report_migration_policy = atom_constant<atom("remipo")>;
 using exit_reporter = atom_constant<atom("er")>;
 
 // Atoms used by cluster nodes
@@ -40,6 +40,66 @@ using migration_payload = std::vector<std::pair<island_id, wrapper<individual, f
 template<typename individual, typename fitness_value>
 using inserter = std::back_insert_iterator<population<individual, fitness_value>>;
 
+/**
+ * @brief A reference counted collection of individuals shared by actors on the same machine.
+ * @details Sending a snapshot along with an index range hands individuals over to local actors without
+ * copying them. Snapshots cannot be serialized, slice has to be sent to remote actors instead. Actors
+ * receiving a snapshot only read it.
+ */
+template<typename individual>
+struct population_snapshot {
+  std::shared_ptr<std::vector<individual>> individuals;
+
+  std::vector<individual> slice(size_t begin, size_t end) const {
+    return std::vector<individual>(std::next(individuals->begin(), begin), std::next(individuals->begin(), end));
+  }
+};
+
+/**
+ * @brief Move the individuals of the given members of a population into a population_snapshot.
+ * @details The members are left without their individuals (their fitness values stay in place) until
+ * restore_snapshot gives them back, so the snapshot has to be restored before the population is used again.
+ * @param pop the population
+ * @param indices the indices of members of pop to include, in order
+ */
+template<typename individual, typename fitness_value>
+population_snapshot<individual> make_snapshot(population<individual, fitness_value> &pop,
+                                              const std::vector<size_t> &indices) {
+  auto individuals = std::make_shared<std::vector<individual>>();
+  individuals->reserve(indices.size());
+  std::transform(std::begin(indices),
+                 std::end(indices),
+                 std::back_inserter(*individuals),
+                 [&pop](size_t i) { return std::move(pop[i].first); });
+
+  return population_snapshot<individual>{std::move(individuals)};
+}
+
+/**
+ * @brief Give the individuals of a snapshot back to the members of the population they were taken from.
+ * @details The individuals are moved back when no other actor holds the snapshot any more. Otherwise they
+ * are copied, since an actor whose request timed out may still be reading them.
+ * @param pop the population passed to make_snapshot
+ * @param indices the indices passed to make_snapshot
+ * @param snapshot the snapshot
+ */
+template<typename individual, typename fitness_value>
+void restore_snapshot(population<individual, fitness_value> &pop,
+                      const std::vector<size_t> &indices,
+                      const population_snapshot<individual> &snapshot) {
+  auto &individuals = *snapshot.individuals;
+
+  if (snapshot.individuals.use_count() == 1) {
+    for (size_t i = 0; i < indices.size(); ++i) {
+      pop[indices[i]].first = std::move(individuals[i]);
+    }
+  } else {
+    for (size_t i = 0; i < indices.size(); ++i) {
+      pop[indices[i]].first = individuals[i];
+    }
+  }
+}
+
 // Commonly used data
 namespace strings {
 const constexpr char POSSIBLE_VALUES[] = "possible_initialization_values";
@@ -55,6 +115,8 @@ const constexpr char RANGE_C[] = "range_c";
 const constexpr char RANGE_GAMMA[] = "range_gamma";
 const constexpr char NODE_GROUP[] = "node_group";
 const constexpr char MESSAGE_BUS_GROUP[] = "message_bus_group";
+const constexpr char TOURNAMENT_SIZE[] = "tournament_size";
+const constexpr char SELECTION_PRESSURE[] = "selection_pressure";
 
 const constexpr char *const ACTOR_PHASE_MAP[] = {"init_population",
                                                  "execute_phase_1",
@@ -63,9 +125,10 @@ const constexpr char *const ACTOR_PHASE_MAP[] = {"init_population",
                                                  "finish",
                                                  "total",
                                                  "execute_generation",
-                                                 "execute_computation"};
+                                                 "execute_computation",
+                                                 "execute_epoch"};
 
-const constexpr char *const PGA_MODEL_MAP[] = {"Global", "Island", "Grid", "Sequential"};
+const constexpr char *const PGA_MODEL_MAP[] = {"Global", "Island", "Grid", "Sequential", "Cellular"};
 
 const std::vector<std::string> SYSTEM_HEADERS{"Time", "Message"};
 const std::vector<std::string> TIME_HEADERS{"Start", "End", "Total (ms)", "Phase", "Generation", "Island"};
@@ -73,6 +136,7 @@ const std::vector<std::string> INDIVIDUAL_HEADERS{"Generation", "Island", "Indiv
 }
 
 const constexpr auto timeout = std::chrono::seconds(10);
+const constexpr auto straggler_check_period = std::chrono::milliseconds(10);
 const constexpr auto island_0 = island_id{0};
 const constexpr auto island_special = std::numeric_limits<island_id>::max();
 
@@ -100,6 +164,12 @@ constexpr auto is_size_constructible() noexcept {
   return is_same<T, std::vector<V>, std::list<V>, std::forward_list<V>, std::deque<V>>();
 }
 
+template<typename T, typename = void>
+struct has_statistics : std::false_type {};
+
+template<typename T>
+struct has_statistics<T, std::void_t<decltype(std::declval<const T &>().statistics())>> : std::true_type {};
+
 template<typename T, typename V = typename T::value_type>
 auto join(const T &elements, const char *const delimiter = ",") {
   std::ostringstream os;
@@ -159,6 +229,49 @@ typename Inspector::result_type inspect(Inspector &f, reporter_node_info &x) {
            x.individual_reporter_port);
 }
 
+/**
+ * @brief Compact statistics of the fitness values of a population: their sum, count, the best one and
+ * the sum of their squares (from which the spread of fitness values follows). The squares are summed as double,
+ * as they overflow integral fitness values long before the values themselves do.
+ * @details Lets actors evaluate termination checks and migration policies on populations held by other actors
+ * without gathering the populations themselves. Statistics of several populations are combined with merge.
+ */
+template<typename fitness_value>
+struct fitness_statistics {
+  fitness_value sum;
+  size_t count;
+  fitness_value best;
+  double sum_of_squares;
+
+  void merge(const fitness_statistics &other) {
+    if (!other.count) {
+      return;
+    }
+
+    best = count && !(best < other.best) ? best : other.best;
+    sum = sum + other.sum;
+    sum_of_squares = sum_of_squares + other.sum_of_squares;
+    count += other.count;
+  }
+};
+
+template<typename individual, typename fitness_value>
+fitness_statistics<fitness_value> make_statistics(const population<individual, fitness_value> &pop) {
+  fitness_statistics<fitness_value> statistics{fitness_value{}, 0, fitness_value{}, 0.0};
+
+  for (const auto &member : pop) {
+    auto value = static_cast<double>(member.second);
+    statistics.merge({member.second, 1, member.second, value * value});
+  }
+
+  return statistics;
+}
+
+template<class Inspector, typename fitness_value>
+typename Inspector::result_type inspect(Inspector &f, fitness_statistics<fitness_value> &x) {
+  return f(meta::type_name("fitness_statistics"), x.sum, x.count, x.best, x.sum_of_squares);
+}
+
 enum class actor_phase {
   init_population,
   execute_phase_1,
@@ -167,7 +280,8 @@ enum class actor_phase {
   finish,
   total,
   execute_generation,
-  execute_computation
+  execute_computation,
+  execute_epoch
 };
 
 enum class cluster_mode {
@@ -175,7 +289,15 @@ enum class cluster_mode {
 };
 
 enum class pga_model {
-  GLOBAL, ISLAND, GRID, SEQUENTIAL
+  GLOBAL, ISLAND, GRID, SEQUENTIAL, CELLULAR
+};
+
+/**
+ * @brief The cells a cell of the CELLULAR model selects mates from: the four adjacent cells (VON_NEUMANN)
+ * or all eight surrounding cells (MOORE).
+ */
+enum class cellular_neighbourhood {
+  VON_NEUMANN, MOORE
 };
 
 /**
@@ -251,6 +373,10 @@ cluster_properties::cluster_properties() { \
   add_message_type<IND>("IND"); \
   add_message_type<FIT>("FIT"); \
   add_message_type<std::pair<IND, FIT>>("std::pair<IND, FIT>"); \
+  add_message_type<std::vector<std::pair<IND, FIT>>>("std::vector<std::pair<IND, FIT>>"); \
+  add_message_type<std::vector<IND>>("std::vector<IND>"); \
+  add_message_type<std::vector<FIT>>("std::vector<FIT>"); \
+  add_message_type<fitness_statistics<FIT>>("fitness_statistics<FIT>"); \
   add_message_type<std::pair<std::pair<IND, FIT>, \
                              std::pair<IND, FIT>>>("std::pair<std::pair<IND, FIT>, std::pair<IND, FIT>"); \
   add_message_type<std::pair<size_t, std::pair<IND, FIT>>>("std::pair<size_t, std::pair<IND, FIT>>"); \
@@ -293,6 +419,13 @@ inline void system_message(const scoped_actor &self,
              str(std::forward<A>(a), std::forward<As>(as)...));
 }
 
+template<typename T, typename Operator>
+inline void statistics_message(stateful_actor<T> *self, const Operator &op) {
+  if constexpr (has_statistics<Operator>::value) {
+    system_message(self, op.statistics());
+  }
+}
+
 template<typename T, typename ...As>
 inline void generation_message(stateful_actor<T> *self, As &&... as) {
   if (self->state.config->system_props.is_generation_reporter_active)
@@ -320,4 +453,9 @@ inline void log(A &&self, As &&... as) {
 std::vector<actor> bind_remote_workers(actor_system &system, const std::vector<worker_node_info> &infos);
 
 std::tuple<actor, actor, actor> bind_remote_reporters(actor_system &system, const reporter_node_info &info);
+}
+
+namespace caf {
+template<typename individual>
+struct allowed_unsafe_message_type<cpga::population_snapshot<individual>> : std::true_type {};
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include "core/data.hpp"
 #include "core/defaults.hpp"
 #include "core/message_bus.hpp"
+#include "core/pull_dispatch_state.hpp"
+#include "core/shared_state.hpp"
 #include "core/single_machine_runner.hpp"
 
 #endif //GENETIC_ACTOR_CORE_H
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <any>
 #include "../common.hpp"
 #include "message_bus.hpp"
+#include "shared_state.hpp"
 
 namespace cpga {
 namespace core {
@@ -59,6 +60,96 @@ struct system_properties {
    * @brief The number of migrants belonging to the migration payload generated by each island during migration phase.
    */
   size_t migration_quota;
+  /**
+   * @brief The number of individuals sent to a fitness evaluation worker in a single message
+   * by the GLOBAL model executor. Larger batches amortise messaging overhead for cheap fitness functions.
+   */
+  size_t fitness_batch_size;
+  /**
+   * @brief Pull dispatch activation flag. When set, the GLOBAL model supervisor and the GRID model dispatcher
+   * hand a request to a worker only once the worker is idle, rather than assigning requests in a round-robin manner.
+   */
+  bool is_pull_dispatch_active;
+  /**
+   * @brief Load aware dispatch activation flag. When set, the GRID model dispatcher hands each batch to the worker
+   * expected to be done with it first, given the individuals it has outstanding and its measured throughput, so
+   * that slower workers are given less work. Takes precedence over pull dispatch.
+   */
+  bool is_load_aware_dispatch_active;
+  /**
+   * @brief The number of batches per worker the GRID model executor splits a generation into under load aware
+   * dispatch. The more batches, the more work the dispatcher can move away from slower workers, but the smaller
+   * the subpopulations each batch evolves.
+   */
+  size_t grid_batches_per_worker;
+  /**
+   * @brief The time after which GLOBAL and GRID model executors give up on a request sent to workers.
+   */
+  std::chrono::milliseconds request_timeout;
+  /**
+   * @brief The percentile of recent request latencies (e.g. 0.95) beyond which a request is considered to straggle
+   * and is sent again to an idle worker, the first answer being used. Takes effect in pull dispatch mode, 0 disables it.
+   */
+  double straggler_percentile;
+  /**
+   * @brief Steady state activation flag. When set, the GLOBAL model executor drops the generation barrier:
+   * children are bred and dispatched as soon as fitness values arrive and replace the worst members of the population.
+   * Elitism and survival selection operators are not used in this mode.
+   */
+  bool is_steady_state_active;
+  /**
+   * @brief Asynchronous island model activation flag. When set, islands advance through generations on their own,
+   * send migrants every migration_period of their own generations and absorb migrants received in the meantime
+   * between generations, instead of waiting for each other at every migration.
+   */
+  bool is_async_island_active;
+  /**
+   * @brief The number of generations after which the ISLAND model executor consults the termination check
+   * when migration is not active, with migration it is consulted after every migration. Islands report
+   * fitness statistics for the check, which is skipped altogether with default_global_termination_check.
+   */
+  size_t termination_check_period;
+  /**
+   * @brief Population rebalancing activation flag. When set, after every migration of the synchronous ISLAND model
+   * individuals are moved from islands that were slow on their generations to fast ones, so that islands take
+   * about the same time per generation regardless of the speed of the machine they run on.
+   */
+  bool is_island_rebalancing_active;
+  /**
+   * @brief Adaptive migration activation flag. When set, the synchronous ISLAND model executor adapts migration_period
+   * and migration_quota after every migration to the fitness improvement and diversity of islands,
+   * reporting the chosen values through the generation reporter.
+   */
+  bool is_adaptive_migration_active;
+  /**
+   * @brief The number of fitness evaluation workers shared by the islands of a machine in the ISLAND model.
+   * When non-zero, islands send fitness evaluations to this pool instead of performing them themselves,
+   * so that a few islands can make use of many cores. Migration is not affected.
+   */
+  size_t island_evaluators_number;
+  /**
+   * @brief Persistent partitions activation flag. When set, each GRID model worker keeps its partition of the
+   * population across generations and only grid_exchange_fraction of it is shuffled between partitions
+   * by the executor every generation.
+   */
+  bool is_grid_partition_persistent;
+  /**
+   * @brief The fraction of a partition a GRID model worker sends out for exchange every generation
+   * when partitions are persistent.
+   */
+  double grid_exchange_fraction;
+  /**
+   * @brief The maximum number of fitness values held by the cache cached_fitness_evaluation keeps per run and machine.
+   */
+  size_t fitness_cache_capacity;
+  /**
+   * @brief Evaluation tracking activation flag, off by default. When set, models remember which population members
+   * hold a current fitness value (elitists, survivors, migrants) and skip their re-evaluation.
+   * @details Assumes the fitness evaluation operator is deterministic: a member evaluated once keeps its value for
+   * the rest of the run. Leave it unset for noisy or stateful fitness evaluation, whose values have to be refreshed
+   * every generation.
+   */
+  bool is_evaluation_tracking_active;
   /**
    * @brief Elitism activation flag.
    */
@@ -148,6 +239,20 @@ struct system_properties {
    */
   std::string individual_reporter_log;
 
+  /**
+   * @brief The number of rows of the toroidal grid of the CELLULAR model. Rows are split among
+   * islands_number tiles, each owned by a worker.
+   */
+  size_t grid_rows;
+  /**
+   * @brief The number of columns of the toroidal grid of the CELLULAR model.
+   */
+  size_t grid_columns;
+  /**
+   * @brief The neighbourhood cells of the CELLULAR model select their mates from.
+   */
+  cellular_neighbourhood neighbourhood;
+
   /**
    * @brief Intended PGA model of this configuration.
    */
@@ -171,6 +276,12 @@ struct system_properties {
       } else {
         throw std::runtime_error("total_population_size > 0 in grid model");
       }
+    } else if (model == pga_model::CELLULAR) {
+      if (grid_rows && grid_columns && islands_number) {
+        population_size = grid_rows * grid_columns;
+      } else {
+        throw std::runtime_error("grid_rows > 0 && grid_columns > 0 && islands_number > 0 in cellular model");
+      }
     }
   }
 
@@ -202,6 +313,13 @@ struct system_properties {
     model = pga_model::SEQUENTIAL;
   }
 
+  /**
+   * @brief Define this configration for cellular model.
+   */
+  inline void cellular_model() {
+    model = pga_model::CELLULAR;
+  }
+
   system_properties();
 };
 
@@ -249,6 +367,11 @@ struct configuration {
    * @brief The local message bus (not intended to be used across the network).
    */
   message_bus bus;
+
+  /**
+   * @brief The state shared by genetic operators for the duration of this run (not shared across the network).
+   */
+  mutable shared_state operator_states;
 };
 
 /**
@@ -274,13 +397,40 @@ inline void show_model_info(A &&self, const system_properties &props) {
       log(self, "-- Per island initial population size: ", props.population_size);
       log(self, "-- Migration quota: ", props.migration_quota);
       log(self, "-- Migration period: ", props.migration_period, " generations");
+      log(self, "-- Evaluators per machine: ", props.island_evaluators_number);
+      log(self, "-- Migration: ", props.is_async_island_active ? "asynchronous" : "synchronous");
+      log(self, "-- Termination check period: ", props.termination_check_period, " generations");
+      log(self, "-- Population rebalancing: ", props.is_island_rebalancing_active ? "on" : "off");
+      log(self, "-- Adaptive migration: ", props.is_adaptive_migration_active ? "on" : "off");
       break;
     case pga_model::GRID:log(self, "-- Total initial population size: ", props.population_size);
       log(self, "-- Grid workers: ", props.islands_number);
+      log(self, "-- Dispatch: ", props.is_load_aware_dispatch_active ? "load aware"
+                                 : props.is_pull_dispatch_active ? "pull" : "round-robin");
+      if (props.is_load_aware_dispatch_active) {
+        log(self, "-- Batches per worker: ", props.grid_batches_per_worker);
+      }
+      log(self, "-- Request timeout: ", props.request_timeout.count(), " ms");
+      log(self, "-- Straggler percentile: ", props.straggler_percentile);
+      if (props.is_grid_partition_persistent) {
+        log(self, "-- Persistent partitions, exchange fraction: ", props.grid_exchange_fraction);
+      }
+      break;
+    case pga_model::GLOBAL:log(self, "-- Total initial population size: ", props.population_size);
+      log(self, "-- Fitness evaluation batch size: ", props.fitness_batch_size);
+      log(self, "-- Fitness evaluation dispatch: ", props.is_pull_dispatch_active ? "pull" : "round-robin");
+      log(self, "-- Request timeout: ", props.request_timeout.count(), " ms");
+      log(self, "-- Straggler percentile: ", props.straggler_percentile);
+      log(self, "-- Replacement: ", props.is_steady_state_active ? "steady state" : "generational");
       break;
-    case pga_model::GLOBAL:
     case pga_model::SEQUENTIAL:log(self, "-- Total initial population size: ", props.population_size);
       break;
+    case pga_model::CELLULAR:log(self, "-- Total initial population size: ", props.population_size);
+      log(self, "-- Grid: ", props.grid_rows, " x ", props.grid_columns);
+      log(self, "-- Tiles: ", props.islands_number);
+      log(self, "-- Neighbourhood: ",
+          props.neighbourhood == cellular_neighbourhood::MOORE ? "Moore" : "von Neumann");
+      break;
   }
   std::vector<std::string> reporters;
   if (props.is_generation_reporter_active)
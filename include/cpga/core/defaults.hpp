@@ -42,6 +42,14 @@ struct default_migration_operator : base_operator {
   noexcept {
     return {};
   }
+
+  migration_payload<individual, fitness_value> operator()(
+      island_id from,
+      population<individual, fitness_value> &population,
+      size_t quota) const
+  noexcept {
+    return {};
+  }
 };
 
 template<typename individual, typename fitness_value>
@@ -53,6 +61,12 @@ struct default_global_termination_check : base_operator {
   noexcept {
     return false;
   }
+
+  bool operator()(
+      const fitness_statistics<fitness_value> &statistics) const
+  noexcept {
+    return false;
+  }
 };
 }
 }
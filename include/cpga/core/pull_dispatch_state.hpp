@@ -0,0 +1,209 @@
+#ifndef GENETIC_ACTOR_PULL_DISPATCH_STATE_H
+#define GENETIC_ACTOR_PULL_DISPATCH_STATE_H
+
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include "base_state.hpp"
+#include "../utilities/latency_tracker.hpp"
+
+namespace cpga {
+using namespace atoms;
+using namespace utilities;
+namespace core {
+/**
+ * @brief A request handed out by a dispatcher to its workers.
+ * @details The send function issues one more attempt of the request to a given worker, it is called
+ * once for the original attempt and once more if the request is found to straggle.
+ */
+struct dispatched_request {
+  std::function<void(const actor &, size_t)> send;
+  std::chrono::high_resolution_clock::time_point started;
+  size_t attempts;
+  bool is_duplicated;
+};
+
+/**
+ * @brief The state shared by actors dispatching requests to a pool of workers.
+ * @details Workers are either chosen in a round-robin manner (get_worker) or, in pull dispatch mode,
+ * each worker is handed the next pending request only once it has answered the previous one.
+ * In pull dispatch mode the latencies of answered requests are tracked and, when
+ * system_properties.straggler_percentile is set, a request running longer than that percentile
+ * of recent latencies is sent again to an idle worker. Whichever attempt answers first is used.
+ */
+struct pull_dispatch_state : public base_state {
+  pull_dispatch_state() = default;
+  pull_dispatch_state(const shared_config &config, std::vector<actor> &workers)
+      : base_state{config},
+        pool{workers.size()},
+        counter{0},
+        request_counter{0},
+        is_straggler_check_scheduled{false},
+        workers{std::move(workers)},
+        idle_workers(this->workers.begin(), this->workers.end()) {
+  }
+
+  inline auto get_worker() noexcept {
+    return workers[counter++ % pool];
+  }
+
+  inline void release_worker(const actor &worker) {
+    if (std::find(std::begin(workers), std::end(workers), worker) != std::end(workers)) {
+      idle_workers.push_back(worker);
+    }
+  }
+
+  inline void remove_worker(const actor_addr &source) {
+    auto is_source = [&source](const auto &worker) { return source == worker; };
+
+    workers.erase(std::remove_if(std::begin(workers), std::end(workers), is_source), std::end(workers));
+    idle_workers.erase(std::remove_if(std::begin(idle_workers), std::end(idle_workers), is_source),
+                       std::end(idle_workers));
+    pool = workers.size();
+  }
+
+  size_t pool;
+  size_t counter;
+  size_t request_counter;
+  bool is_straggler_check_scheduled;
+  std::vector<actor> workers;
+  std::deque<actor> idle_workers;
+  std::deque<size_t> pending;
+  std::unordered_map<size_t, dispatched_request> in_flight;
+  latency_tracker latencies;
+};
+
+/**
+ * @brief Hand out pending requests to idle workers for as long as there are both.
+ */
+template<typename Actor>
+void dispatch_pending(Actor *self) {
+  auto &state = self->state;
+
+  while (!state.pending.empty() && !state.idle_workers.empty()) {
+    auto id = state.pending.front();
+    state.pending.pop_front();
+
+    auto request = state.in_flight.find(id);
+    if (request == state.in_flight.end()) {
+      continue;
+    }
+
+    auto worker = std::move(state.idle_workers.front());
+    state.idle_workers.pop_front();
+
+    if (!request->second.attempts++) {
+      request->second.started = now();
+    }
+
+    request->second.send(worker, id);
+  }
+}
+
+/**
+ * @brief Periodically look for straggling requests while there are requests in flight.
+ */
+template<typename Actor>
+void schedule_straggler_check(Actor *self) {
+  auto &state = self->state;
+
+  if (state.config->system_props.straggler_percentile > 0
+      && !state.is_straggler_check_scheduled
+      && !state.in_flight.empty()) {
+    state.is_straggler_check_scheduled = true;
+    self->delayed_send(self, straggler_check_period, check_stragglers::value);
+  }
+}
+
+/**
+ * @brief Queue a request for pull dispatch.
+ * @param send the function sending an attempt of the request to a worker
+ */
+template<typename Actor>
+void submit_request(Actor *self, std::function<void(const actor &, size_t)> send) {
+  auto &state = self->state;
+  auto id = state.request_counter++;
+
+  state.in_flight.emplace(id, dispatched_request{std::move(send), now(), 0, false});
+  state.pending.push_back(id);
+
+  dispatch_pending(self);
+  schedule_straggler_check(self);
+}
+
+/**
+ * @brief Account for an answer to an attempt of a request.
+ * @return Whether this is the first answer, i.e. the one to deliver to the requester.
+ */
+template<typename Actor>
+bool complete_request(Actor *self, size_t id, const actor &worker) {
+  auto &state = self->state;
+  auto request = state.in_flight.find(id);
+  auto is_first = request != state.in_flight.end();
+
+  if (is_first) {
+    state.latencies.record(now() - request->second.started);
+    state.in_flight.erase(request);
+  }
+
+  state.release_worker(worker);
+  dispatch_pending(self);
+
+  return is_first;
+}
+
+/**
+ * @brief Account for a failed attempt of a request.
+ * @return Whether no other attempt of the request can answer it anymore, i.e. the error has to be delivered.
+ */
+template<typename Actor>
+bool fail_request(Actor *self, size_t id, const actor &worker) {
+  auto &state = self->state;
+  auto request = state.in_flight.find(id);
+  auto is_last = request != state.in_flight.end() && --request->second.attempts == 0;
+
+  if (is_last) {
+    state.in_flight.erase(request);
+  }
+
+  state.release_worker(worker);
+  dispatch_pending(self);
+
+  return is_last;
+}
+
+/**
+ * @brief Send a duplicate of every request running longer than the configured percentile of
+ * recent latencies, for as long as there are idle workers to take them.
+ */
+template<typename Actor>
+void resend_stragglers(Actor *self) {
+  auto &state = self->state;
+
+  state.is_straggler_check_scheduled = false;
+
+  if (auto threshold = state.latencies.percentile(state.config->system_props.straggler_percentile)) {
+    auto current = now();
+
+    for (auto &[id, request] : state.in_flight) {
+      if (state.pending.size() >= state.idle_workers.size()) {
+        break;
+      }
+
+      if (request.attempts == 1 && !request.is_duplicated && current - request.started > *threshold) {
+        request.is_duplicated = true;
+        state.pending.push_front(id);
+
+        system_message(self, "Request ", id, " straggles, sending a duplicate to an idle worker");
+      }
+    }
+
+    dispatch_pending(self);
+  }
+
+  schedule_straggler_check(self);
+}
+}
+}
+
+#endif //GENETIC_ACTOR_PULL_DISPATCH_STATE_H
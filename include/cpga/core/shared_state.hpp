@@ -0,0 +1,49 @@
+#ifndef GENETIC_ACTOR_SHARED_STATE_H
+#define GENETIC_ACTOR_SHARED_STATE_H
+
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+namespace cpga {
+namespace core {
+/**
+ * @brief A thread safe registry of objects shared by the genetic operators of a single run.
+ * @details Genetic operators are constructed separately for every worker or island. An operator which
+ * needs state common to all of its instances (e.g. a fitness cache) obtains it from the registry of the
+ * configuration, so that the state lives exactly as long as the configuration of the run, instead of
+ * being kept in a static variable for the lifetime of the process.
+ */
+class shared_state {
+ private:
+  std::unordered_map<std::type_index, std::shared_ptr<void>> states;
+  std::mutex mutex;
+ public:
+  shared_state() = default;
+  shared_state(const shared_state &) = delete;
+  shared_state &operator=(const shared_state &) = delete;
+
+  /**
+   * @brief Get the object registered for a key type, creating it first if there is none.
+   * @tparam key the type identifying the object, usually the operator class owning it
+   * @tparam T the type of the object
+   * @param args the arguments of the constructor of T, used only when the object is created
+   * @return The object registered for key.
+   */
+  template<typename key, typename T, typename... Args>
+  std::shared_ptr<T> get(Args &&... args) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    auto &state = states[std::type_index{typeid(key)}];
+    if (!state) {
+      state = std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
+    return std::static_pointer_cast<T>(state);
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_SHARED_STATE_H
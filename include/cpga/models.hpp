@@ -6,11 +6,14 @@
 #define GENETIC_ACTOR_MODELS_H
 
 #include "core.hpp"
+#include "models/distributed/cellular_model_cluster.hpp"
 #include "models/distributed/global_model_cluster.hpp"
 #include "models/distributed/grid_model_cluster.hpp"
 #include "models/distributed/island_model_cluster.hpp"
 #include "models/single_machine/island_model_single_machine.hpp"
 #include "models/single_machine/global_model_single_machine.hpp"
 #include "models/single_machine/grid_model_single_machine.hpp"
+#include "models/single_machine/cellular_model_single_machine.hpp"
+#include "models/sequential_model.hpp"
 
 #endif //GENETIC_ACTOR_MODELS_H
@@ -0,0 +1,470 @@
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include "../core.hpp"
+
+namespace cpga {
+using namespace core;
+using namespace atoms;
+namespace models {
+/*
+ * This file defines the behaviour of cellular model PGA.
+ * Individuals sit on the cells of a 2D torus of grid_rows x grid_columns cells and only mate
+ * with individuals of their neighbourhood (von Neumann or Moore). The grid is split into stripes
+ * of consecutive rows, so called tiles, each owned by a Worker (cellular_model_worker). Every
+ * generation a Worker sends its first and last row to the Workers owning the tiles above and below
+ * (the halo rows), so that cells on the border of a tile can see their neighbours, then it updates
+ * all of its cells at once. The Executor (cellular_model_executor) initialises the population,
+ * hands out the tiles and runs generations in lockstep until it collects the tiles back.
+ */
+
+/*
+ * WORKER
+ *
+ * Owns a tile of the grid. A cell mates with the fitter of two random neighbours and
+ * is replaced by the first child produced by crossover and mutation, provided the child
+ * is not less fit than the cell.
+ */
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator,
+    typename crossover_operator,
+    typename mutation_operator>
+struct cellular_model_worker_state : public base_state {
+  cellular_model_worker_state() = default;
+  cellular_model_worker_state(const shared_config &config, island_id tile_no)
+      : base_state{config},
+        fitness_evaluation{config, tile_no},
+        crossover{config, tile_no},
+        mutation{config, tile_no},
+        tile_no{tile_no},
+        columns{config->system_props.grid_columns},
+        halos_received{0},
+        current_generation{0},
+        is_generation_pending{false},
+        generator{config->system_props.parent_selection_seed
+                      + (config->system_props.add_island_no_to_seed ? tile_no : 0)} {
+    halo_above.reserve(columns);
+    halo_below.reserve(columns);
+  }
+
+  fitness_evaluation_operator fitness_evaluation;
+  crossover_operator crossover;
+  mutation_operator mutation;
+
+  island_id tile_no;
+  size_t columns;
+  size_t halos_received;
+  size_t current_generation;
+  bool is_generation_pending;
+
+  actor above;
+  actor below;
+  typed_response_promise<bool> promise;
+  std::default_random_engine generator;
+
+  population<individual, fitness_value> tile;
+  population<individual, fitness_value> next;
+  population<individual, fitness_value> halo_above;
+  population<individual, fitness_value> halo_below;
+  population<individual, fitness_value> offspring;
+
+  inline size_t rows() const noexcept {
+    return columns ? tile.size() / columns : 0;
+  }
+
+  /**
+   * @brief The cell at the given row and column relative to the tile, where row -1 and row rows()
+   * refer to the halo rows and columns wrap around the torus.
+   */
+  inline const wrapper<individual, fitness_value> &cell(long row, long column) const noexcept {
+    auto col = static_cast<size_t>((column + static_cast<long>(columns)) % static_cast<long>(columns));
+
+    if (row < 0) {
+      return halo_above[col];
+    } else if (static_cast<size_t>(row) >= rows()) {
+      return halo_below[col];
+    }
+
+    return tile[static_cast<size_t>(row) * columns + col];
+  }
+
+  /**
+   * @brief Pick the fitter of two random neighbours of a cell.
+   */
+  const wrapper<individual, fitness_value> &select_mate(long row, long column) {
+    static const long von_neumann[][2]{{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    static const long moore[][2]{{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+
+    auto is_moore = config->system_props.neighbourhood == cellular_neighbourhood::MOORE;
+    auto offsets = is_moore ? moore : von_neumann;
+    std::uniform_int_distribution<size_t> distribution{0, is_moore ? size_t{7} : size_t{3}};
+
+    auto first = offsets[distribution(generator)];
+    auto second = offsets[distribution(generator)];
+
+    const auto &a = cell(row + first[0], column + first[1]);
+    const auto &b = cell(row + second[0], column + second[1]);
+
+    return a.second < b.second ? b : a;
+  }
+
+  /**
+   * @brief Compute the next generation of the tile once both halo rows of the current one have arrived.
+   */
+  template<typename Actor>
+  void try_update(Actor *self) {
+    if (!is_generation_pending || halos_received < 2) {
+      return;
+    }
+
+    next.clear();
+    next.reserve(tile.size());
+
+    for (long row = 0; row < static_cast<long>(rows()); ++row) {
+      for (long column = 0; column < static_cast<long>(columns); ++column) {
+        const auto &current = cell(row, column);
+
+        offspring.clear();
+        crossover(std::back_inserter(offspring), wrapper_pair<individual, fitness_value>{
+            current, select_mate(row, column)});
+
+        if (offspring.empty()) {
+          next.emplace_back(current);
+          continue;
+        }
+
+        auto &child = offspring.front();
+        mutation(child);
+        child.second = fitness_evaluation(child.first);
+
+        if (child.second < current.second) {
+          next.emplace_back(current);
+        } else {
+          next.emplace_back(std::move(child));
+        }
+      }
+    }
+
+    tile.swap(next);
+    halos_received = 0;
+    is_generation_pending = false;
+
+    generation_message(self, note_end::value, now(), actor_phase::execute_generation, current_generation, tile_no);
+
+    promise.deliver(true);
+  }
+};
+
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator,
+    typename crossover_operator,
+    typename mutation_operator>
+behavior cellular_model_worker(
+    stateful_actor<
+    cellular_model_worker_state<individual, fitness_value,
+                                fitness_evaluation_operator, crossover_operator, mutation_operator>> *self,
+    const shared_config &config) {
+  message_handler main_behavior{
+      /*
+       * Send the halo rows to the neighbouring tiles, the tile is updated
+       * once the halo rows of the neighbouring tiles arrive as well
+       */
+      [self](execute_generation, size_t gen) -> result<bool> {
+        auto &state = self->state;
+        auto columns = static_cast<std::ptrdiff_t>(state.columns);
+
+        generation_message(self, note_start::value, now(), state.tile_no);
+
+        population<individual, fitness_value> first_row(state.tile.begin(), std::next(state.tile.begin(), columns));
+        population<individual, fitness_value> last_row(std::prev(state.tile.end(), columns), state.tile.end());
+
+        self->send(state.above, receive_halo::value, false, std::move(first_row));
+        self->send(state.below, receive_halo::value, true, std::move(last_row));
+
+        state.promise = self->template make_response_promise<bool>();
+        state.current_generation = gen;
+        state.is_generation_pending = true;
+        state.try_update(self);
+
+        return state.promise;
+      },
+      [self](receive_halo, bool is_above, population<individual, fitness_value> &row) {
+        auto &state = self->state;
+
+        (is_above ? state.halo_above : state.halo_below).swap(row);
+        ++state.halos_received;
+
+        state.try_update(self);
+      },
+      [self](finish) {
+        auto &state = self->state;
+
+        statistics_message(self, state.fitness_evaluation);
+        system_message(self, "Quitting cellular model worker (tile: ", state.tile_no, ")");
+        self->quit();
+
+        return std::move(state.tile);
+      }
+  };
+
+  self->set_default_handler([](scheduled_actor *, message_view &) {
+    return skip();
+  });
+
+  return {
+      /*
+       * Receive the tile along with the handles of workers owning the tiles above
+       * and below, then evaluate its cells
+       */
+      [=](assign_id, island_id tile_no, const actor &above, const actor &below,
+          population<individual, fitness_value> &tile) {
+        self->state = cellular_model_worker_state<individual, fitness_value,
+                                                  fitness_evaluation_operator, crossover_operator,
+                                                  mutation_operator>{config, tile_no};
+        self->state.above = above;
+        self->state.below = below;
+        self->state.tile = std::move(tile);
+
+        for (auto&[ind, value] : self->state.tile) {
+          value = self->state.fitness_evaluation(ind);
+        }
+
+        self->become(main_behavior);
+
+        return true;
+      },
+      [self](finish) {
+        system_message(self, "Quitting unused cellular model worker");
+        self->quit();
+
+        return population<individual, fitness_value>{};
+      }
+  };
+}
+
+/*
+ * EXECUTOR
+ *
+ * Initialises the population, splits it into tiles of consecutive rows
+ * (spreading the remainder rows one per tile) and runs generations in lockstep:
+ * the next generation starts once every tile reported the previous one done.
+ * At the end the tiles are collected back into the population and reported.
+ */
+template<typename individual, typename fitness_value, typename initialization_operator>
+struct cellular_model_executor_state : public base_state {
+  cellular_model_executor_state() = default;
+  cellular_model_executor_state(const shared_config &config, std::vector<actor> &workers)
+      : base_state{config},
+        initialization{config, island_special},
+        workers{std::move(workers)},
+        tiles_done{0},
+        current_generation{0},
+        is_finishing{false} {
+    main.reserve(config->system_props.population_size);
+  }
+
+  initialization_operator initialization;
+  std::vector<actor> workers;
+  std::vector<actor> tiles;
+  std::vector<population<individual, fitness_value>> collected;
+  population<individual, fitness_value> main;
+  size_t tiles_done;
+  size_t current_generation;
+  bool is_finishing;
+};
+
+template<typename individual, typename fitness_value, typename initialization_operator>
+behavior cellular_model_executor(
+    stateful_actor<cellular_model_executor_state<individual, fitness_value, initialization_operator>> *self,
+    cellular_model_executor_state<individual, fitness_value, initialization_operator> state) {
+  self->state = std::move(state);
+
+  system_message(self, "Spawning cellular model executor");
+
+  const auto &props = self->state.config->system_props;
+
+  /*
+   * Start collecting the tiles, unless it has been started already
+   */
+  auto start_finishing = [self] {
+    if (!self->state.is_finishing) {
+      self->state.is_finishing = true;
+      self->send(self, finish::value);
+    }
+  };
+
+  /*
+   * Send a request to every tile, executing the callback once all of them answered
+   */
+  auto request_tiles = [self, start_finishing](auto make_request, auto callback) {
+    auto &state = self->state;
+    state.tiles_done = 0;
+
+    // Once finishing has started, late answers of the tiles are ignored
+    for (size_t i = 0; i < state.tiles.size(); ++i) {
+      make_request(i).then(
+          [self, callback](bool) {
+            if (!self->state.is_finishing && ++self->state.tiles_done == self->state.tiles.size()) {
+              callback();
+            }
+          },
+          [self, i, start_finishing](error &err) {
+            if (self->state.is_finishing) {
+              return;
+            }
+
+            system_message(self, "Tile ", i, " failed with error code: ", err.code(), ", quitting...");
+            start_finishing();
+          }
+      );
+    }
+  };
+
+  return {
+      [=](init_population) {
+        auto &state = self->state;
+
+        generation_message(self, note_start::value, now(), island_special);
+        generation_message(self, note_start::value, now(), island_special);
+
+        state.initialization(std::back_inserter(state.main));
+
+        auto rows = props.grid_rows;
+        auto tiles = std::min(state.workers.size(), rows);
+
+        if (!tiles) {
+          system_message(self, "No workers to own the tiles, quitting...");
+          start_finishing();
+          return;
+        }
+
+        state.tiles.assign(state.workers.begin(), std::next(state.workers.begin(), tiles));
+
+        for (auto i = tiles; i < state.workers.size(); ++i) {
+          self->send(state.workers[i], finish::value);
+        }
+
+        auto per_tile = rows / tiles;
+        auto remainder = rows % tiles;
+
+        std::vector<population<individual, fitness_value>> parts(tiles);
+        auto begin = state.main.begin();
+        for (size_t i = 0; i < tiles; ++i) {
+          auto end = std::next(begin, (per_tile + (i < remainder ? 1 : 0)) * props.grid_columns);
+          parts[i].assign(std::make_move_iterator(begin), std::make_move_iterator(end));
+          begin = end;
+        }
+        state.main.clear();
+
+        request_tiles(
+            [self, parts](size_t i) mutable {
+              auto &tiles = self->state.tiles;
+              auto above = tiles[(i + tiles.size() - 1) % tiles.size()];
+              auto below = tiles[(i + 1) % tiles.size()];
+
+              return self->request(tiles[i], infinite, assign_id::value, island_id{i}, above, below,
+                                   std::move(parts[i]));
+            },
+            [self] {
+              self->send(self, execute_phase_1::value);
+            });
+
+        generation_message(self,
+                           note_end::value,
+                           now(),
+                           actor_phase::init_population,
+                           state.current_generation,
+                           island_special);
+      },
+      [=](execute_phase_1) {
+        auto &state = self->state;
+
+        if (state.current_generation >= props.generations_number) {
+          start_finishing();
+          return;
+        }
+
+        generation_message(self, note_start::value, now(), island_special);
+
+        request_tiles(
+            [self](size_t i) {
+              return self->request(self->state.tiles[i],
+                                   infinite,
+                                   execute_generation::value,
+                                   self->state.current_generation);
+            },
+            [self] {
+              auto &state = self->state;
+
+              generation_message(self,
+                                 note_end::value,
+                                 now(),
+                                 actor_phase::execute_phase_1,
+                                 state.current_generation,
+                                 island_special);
+
+              ++state.current_generation;
+              log(self, "Generations so far: ", state.current_generation);
+
+              self->send(self, execute_phase_1::value);
+            });
+      },
+      /*
+       * Collect the tiles in order and report the population
+       */
+      [=](finish) {
+        auto &state = self->state;
+
+        state.is_finishing = true;
+        state.collected.assign(state.tiles.size(), {});
+        state.tiles_done = 0;
+
+        if (state.tiles.empty()) {
+          self->quit();
+          return;
+        }
+
+        for (size_t i = 0; i < state.tiles.size(); ++i) {
+          self->request(state.tiles[i], props.request_timeout, finish::value).then(
+              [self, i](population<individual, fitness_value> &tile) {
+                auto &state = self->state;
+
+                state.collected[i] = std::move(tile);
+
+                if (++state.tiles_done == state.tiles.size()) {
+                  for (auto &part : state.collected) {
+                    state.main.insert(state.main.end(),
+                                      std::make_move_iterator(part.begin()),
+                                      std::make_move_iterator(part.end()));
+                  }
+
+                  generation_message(self,
+                                     note_end::value,
+                                     now(),
+                                     actor_phase::total,
+                                     state.current_generation,
+                                     island_special);
+                  individual_message(self,
+                                     report_population::value,
+                                     state.main,
+                                     state.current_generation,
+                                     island_special);
+                  system_message(self, "Quitting cellular model executor");
+                  self->quit();
+                }
+              },
+              [self, i](error &err) {
+                system_message(self, "Failed to collect tile ", i, " with error code: ", err.code());
+
+                if (++self->state.tiles_done == self->state.tiles.size()) {
+                  self->quit();
+                }
+              }
+          );
+        }
+      },
+  };
+}
+}
+}
@@ -0,0 +1,78 @@
+#ifndef GENETIC_ACTOR_CELLULAR_MODEL_CLUSTER_H
+#define GENETIC_ACTOR_CELLULAR_MODEL_CLUSTER_H
+
+#include "../../atoms.hpp"
+#include "../../core.hpp"
+#include "../../cluster.hpp"
+#include "../cellular_model.hpp"
+
+namespace cpga {
+using namespace cluster;
+using namespace atoms;
+namespace models {
+template<typename individual, typename fitness_value, typename initialization_operator>
+class cellular_master_node_driver : public master_node_driver {
+ public:
+  using master_node_driver::master_node_driver;
+
+  actor spawn_executor(stateful_actor<base_state> *self, std::vector<actor> &workers) override {
+    auto &config = self->state.config;
+
+    auto executor = self->spawn<detached + monitored>(
+        cellular_model_executor<individual, fitness_value, initialization_operator>,
+        cellular_model_executor_state<individual, fitness_value, initialization_operator>{config, workers});
+
+    self->send(executor, init_population::value);
+
+    return executor;
+  }
+};
+
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator,
+    typename crossover_operator,
+    typename mutation_operator>
+class cellular_worker_node_driver : public worker_node_driver {
+ public:
+  using worker_node_driver::worker_node_driver;
+
+  std::vector<actor> spawn_workers(stateful_actor<worker_node_executor_state> *self) override {
+    auto &state = self->state;
+    auto &config = state.config;
+
+    std::vector<actor> workers(system_props.islands_number);
+    auto spawn_worker = [&]() -> actor {
+      auto &worker_fun = cellular_model_worker<individual, fitness_value,
+                                               fitness_evaluation_operator,
+                                               crossover_operator, mutation_operator>;
+
+      return self->template spawn<monitored + detached>(worker_fun, config);
+    };
+    std::generate(std::begin(workers), std::end(workers), spawn_worker);
+
+    return workers;
+  }
+};
+
+/**
+ * @brief This alias facilitates running cellular model PGA on a cluster.
+ * @see cluster_runner
+ */
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator,
+    typename initialization_operator,
+    typename crossover_operator,
+    typename mutation_operator>
+using cellular_cluster_runner = cluster_runner<cellular_master_node_driver<individual,
+                                                                           fitness_value,
+                                                                           initialization_operator>,
+                                               cellular_worker_node_driver<individual,
+                                                                           fitness_value,
+                                                                           fitness_evaluation_operator,
+                                                                           crossover_operator,
+                                                                           mutation_operator>,
+                                               reporter_node_driver<individual, fitness_value>>;
+}
+}
+
+#endif //GENETIC_ACTOR_CELLULAR_MODEL_CLUSTER_H
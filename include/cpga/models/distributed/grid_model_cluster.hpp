@@ -14,9 +14,7 @@ namespace cpga {
 using namespace cluster;
 using namespace atoms;
 namespace models {
-template<typename individual, typename fitness_value,
-    typename fitness_evaluation_operator,
-    typename initialization_operator>
+template<typename individual, typename fitness_value, typename initialization_operator>
 class grid_master_node_driver : public master_node_driver {
  public:
   using master_node_driver::master_node_driver;
@@ -28,11 +26,11 @@ class grid_master_node_driver : public master_node_driver {
         grid_model_dispatcher<individual, fitness_value>,
         grid_model_dispatcher_state{config, workers});
 
-    auto executor = self->spawn<detached + monitored>(
-        grid_model_executor<individual, fitness_value, initialization_operator,
-                            fitness_evaluation_operator>,
-        config,
-        dispatcher);
+    auto executor_behavior = config->system_props.is_grid_partition_persistent
+                             ? grid_model_persistent_executor<individual, fitness_value, initialization_operator>
+                             : grid_model_executor<individual, fitness_value, initialization_operator>;
+
+    auto executor = self->spawn<detached + monitored>(executor_behavior, config, dispatcher);
 
     self->send(executor, init_population::value);
 
@@ -87,7 +85,6 @@ template<typename individual, typename fitness_value,
     typename elitism_operator = default_elitism_operator<individual, fitness_value>>
 using grid_cluster_runner = cluster_runner<grid_master_node_driver<individual,
                                                                    fitness_value,
-                                                                   fitness_evaluation_operator,
                                                                    initialization_operator>,
                                            grid_worker_node_driver<individual,
                                                                    fitness_value,
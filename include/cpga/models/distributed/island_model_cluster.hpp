@@ -14,7 +14,7 @@ namespace cpga {
 using namespace cluster;
 using namespace atoms;
 namespace models {
-template<typename individual, typename fitness_value>
+template<typename individual, typename fitness_value, typename global_termination_check>
 class island_master_node_driver : public master_node_driver {
  public:
   using master_node_driver::master_node_driver;
@@ -25,9 +25,10 @@ class island_master_node_driver : public master_node_driver {
     auto dispatcher = self->spawn<detached>(island_model_dispatcher<individual, fitness_value>,
                                             island_model_dispatcher_state{config, workers});
 
-    auto executor = self->spawn<detached + monitored>(island_model_executor,
-                                                      island_model_executor_state{config},
-                                                      dispatcher);
+    auto executor = self->spawn<detached + monitored>(
+        island_model_executor<individual, fitness_value, global_termination_check>,
+        island_model_executor_state<individual, fitness_value, global_termination_check>{config},
+        dispatcher);
 
     self->send(executor, execute_phase_1::value);
 
@@ -51,6 +52,11 @@ class island_worker_node_driver : public worker_node_driver {
   std::vector<actor> spawn_workers(stateful_actor<worker_node_executor_state> *self) override {
     auto &config = self->state.config;
 
+    actor evaluators;
+    if (system_props.island_evaluators_number) {
+      evaluators = spawn_island_evaluators<individual, fitness_value, fitness_evaluation_operator>(self, config);
+    }
+
     std::vector<actor> workers(system_props.islands_number);
     auto spawn_worker = [&] {
       return self->template spawn<monitored + detached>(island_model_worker<individual, fitness_value,
@@ -62,10 +68,15 @@ class island_worker_node_driver : public worker_node_driver {
                                                                             survival_selection_operator,
                                                                             elitism_operator,
                                                                             migration_operator>,
-                                                        config);
+                                                        config,
+                                                        evaluators);
     };
     std::generate(std::begin(workers), std::end(workers), spawn_worker);
 
+    if (evaluators) {
+      self->template spawn<detached>(island_evaluators_guard, evaluators, workers);
+    }
+
     return workers;
   }
 };
@@ -85,9 +96,12 @@ template<typename individual, typename fitness_value,
     typename elitism_operator = default_elitism_operator<individual,
                                                          fitness_value>,
     typename migration_operator = default_migration_operator<individual,
-                                                             fitness_value>>
+                                                             fitness_value>,
+    typename global_termination_check = default_global_termination_check<individual,
+                                                                         fitness_value>>
 using island_cluster_runner = cluster_runner<island_master_node_driver<individual,
-                                                                       fitness_value>,
+                                                                       fitness_value,
+                                                                       global_termination_check>,
                                              island_worker_node_driver<individual,
                                                                        fitness_value,
                                                                        fitness_evaluation_operator,
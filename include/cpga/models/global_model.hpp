@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <numeric>
 #include <random>
 #include "../core.hpp"
+#include "../utilities/evaluation_bitmap.hpp"
 
 namespace cpga {
 using namespace core;
@@ -27,8 +29,9 @@ namespace models {
  * WORKER
  *
  * Holds a fitness_evaluation_operator in its state, uses it
- * to perform fitness value evaluation when 'compute_fitness'
- * is received.
+ * to perform fitness value evaluation when an individual,
+ * a 'compute_fitness' batch of individuals or a range of
+ * a population_snapshot is received.
  */
 template<typename fitness_evaluation_operator>
 struct global_model_worker_state : public base_state {
@@ -51,7 +54,31 @@ behavior global_model_worker(stateful_actor<global_model_worker_state<fitness_ev
       [self](const individual &ind) -> fitness_value {
         return self->state.fitness_evaluation(ind);
       },
+      [self](compute_fitness, const std::vector<individual> &batch) -> std::vector<fitness_value> {
+        std::vector<fitness_value> values;
+        values.reserve(batch.size());
+
+        for (const auto &ind : batch) {
+          values.emplace_back(self->state.fitness_evaluation(ind));
+        }
+
+        return values;
+      },
+      [self](compute_fitness,
+             const population_snapshot<individual> &snapshot,
+             size_t begin,
+             size_t end) -> std::vector<fitness_value> {
+        std::vector<fitness_value> values;
+        values.reserve(end - begin);
+
+        for (auto i = begin; i < end; ++i) {
+          values.emplace_back(self->state.fitness_evaluation((*snapshot.individuals)[i]));
+        }
+
+        return values;
+      },
       [self](finish_worker) {
+        statistics_message(self, self->state.fitness_evaluation);
         system_message(self, "Quitting global model worker (actor id: ", self->id(), ")");
         self->quit();
       }
@@ -62,25 +89,19 @@ behavior global_model_worker(stateful_actor<global_model_worker_state<fitness_ev
  * SUPERVISOR
  *
  * Spawns and manages a number of workers, its only role is to
- * delegate the 'compute_fitness' message to a uniformly chosen
- * worker.
+ * delegate the 'compute_fitness' message to a worker. By default
+ * workers are chosen in a round-robin manner. In pull dispatch mode
+ * requests are queued and each worker is handed the next pending
+ * request only once it has answered the previous one, so fast workers
+ * take over the work slow ones would otherwise queue up. Straggling
+ * requests are then sent again to idle workers (see pull_dispatch_state).
+ *
+ * Ranges of a population_snapshot are handed to workers on the same
+ * machine as they are, workers on other machines receive a copy of
+ * the individuals in the range instead, the only copy made of them.
  */
-struct global_model_supervisor_state : public base_state {
-  global_model_supervisor_state() = default;
-  global_model_supervisor_state(const shared_config &config, std::vector<actor> &workers)
-      : base_state{config},
-        pool{workers.size()},
-        counter{0},
-        workers{std::move(workers)} {
-  }
-
-  inline auto get_worker() noexcept {
-    return workers[counter++ % pool];
-  }
-
-  size_t pool;
-  size_t counter;
-  std::vector<actor> workers;
+struct global_model_supervisor_state : public pull_dispatch_state {
+  using pull_dispatch_state::pull_dispatch_state;
 };
 
 template<typename individual, typename fitness_value>
@@ -103,18 +124,70 @@ behavior global_model_supervisor(
 
         system_message(self, "Global worker with actor id: ", down.source.id(), " died");
 
-        auto &workers = self->state.workers;
-        workers.erase(std::remove_if(std::begin(workers),
-                                     std::end(workers),
-                                     [src = down.source](const auto &worker) { return src == worker; }));
-
-        self->state.pool = workers.size();
+        self->state.remove_worker(down.source);
       });
 
   return {
       [self](individual &ind) {
         self->delegate(self->state.get_worker(), std::move(ind));
       },
+      [self](compute_fitness atom, std::vector<individual> &batch) {
+        if (!self->state.config->system_props.is_pull_dispatch_active) {
+          self->delegate(self->state.get_worker(), atom, std::move(batch));
+          return;
+        }
+
+        submit_request(self, [self, atom, rp = self->make_response_promise(), batch = std::move(batch)](
+            const actor &worker, size_t id) {
+          self->request(worker, infinite, atom, batch).then(
+              [self, rp, worker, id](std::vector<fitness_value> &values) mutable {
+                if (complete_request(self, id, worker)) {
+                  rp.deliver(std::move(values));
+                }
+              },
+              [self, rp, worker, id](error &err) mutable {
+                if (fail_request(self, id, worker)) {
+                  rp.deliver(std::move(err));
+                }
+              }
+          );
+        });
+      },
+      [self](compute_fitness atom, const population_snapshot<individual> &snapshot, size_t begin, size_t end) {
+        if (!self->state.config->system_props.is_pull_dispatch_active) {
+          auto worker = self->state.get_worker();
+
+          if (worker.node() == self->node()) {
+            self->delegate(worker, atom, snapshot, begin, end);
+          } else {
+            self->delegate(worker, atom, snapshot.slice(begin, end));
+          }
+          return;
+        }
+
+        submit_request(self, [self, atom, rp = self->make_response_promise(), snapshot, begin, end](
+            const actor &worker, size_t id) {
+          auto on_values = [self, rp, worker, id](std::vector<fitness_value> &values) mutable {
+            if (complete_request(self, id, worker)) {
+              rp.deliver(std::move(values));
+            }
+          };
+          auto on_error = [self, rp, worker, id](error &err) mutable {
+            if (fail_request(self, id, worker)) {
+              rp.deliver(std::move(err));
+            }
+          };
+
+          if (worker.node() == self->node()) {
+            self->request(worker, infinite, atom, snapshot, begin, end).then(on_values, on_error);
+          } else {
+            self->request(worker, infinite, atom, snapshot.slice(begin, end)).then(on_values, on_error);
+          }
+        });
+      },
+      [self](check_stragglers) {
+        resend_stragglers(self);
+      },
       [self](finish) {
         for (const auto &worker : self->state.workers) {
           self->send(worker, finish_worker::value);
@@ -154,8 +227,12 @@ struct global_model_executor_state : public base_state {
         current_generation{0},
         current_island{0},
         compute_fitness_counter{0},
-        population_size_counter{0},
-        offspring_size_counter{0} {
+        main_batches_counter{0},
+        offspring_batches_counter{0},
+        in_flight_counter{0},
+        failures_counter{0},
+        children_counter{0},
+        is_breeding_done{false} {
     main.reserve(
         config->system_props.population_size
             + config->system_props.elitists_number);
@@ -175,14 +252,124 @@ struct global_model_executor_state : public base_state {
   population<individual, fitness_value> main;
   population<individual, fitness_value> offspring;
   population<individual, fitness_value> elitists;
+  evaluation_bitmap evaluated;
 
   size_t current_generation;
   size_t current_island;
   size_t compute_fitness_counter;
-  size_t population_size_counter;
-  size_t offspring_size_counter;
+  size_t main_batches_counter;
+  size_t offspring_batches_counter;
+  size_t in_flight_counter;
+  size_t failures_counter;
+  size_t children_counter;
+  bool is_breeding_done;
 };
 
+/*
+ * Request fitness values for the given members of a population in slices of
+ * fitness_batch_size individuals, each slice is answered with a vector of fitness
+ * values. The callback is executed once every slice has been accounted for.
+ * The individuals of the members are moved into a population_snapshot shared by all
+ * slices and given back once every slice has been accounted for, the supervisor
+ * passes on ranges of it rather than copies of individuals.
+ * Members of slices answered with fitness values are marked in the evaluated
+ * bitmap, if one is given, members of failed slices stay pending.
+ */
+template<typename individual, typename fitness_value, typename executor_actor, typename callback_type>
+void batch_fitness_evaluation(executor_actor *self,
+                              const actor &supervisor,
+                              population<individual, fitness_value> &pop,
+                              const std::vector<size_t> &indices,
+                              size_t &batches_counter,
+                              const char *phase,
+                              callback_type callback,
+                              evaluation_bitmap *evaluated = nullptr) {
+  auto batch_size = std::max(self->state.config->system_props.fitness_batch_size, size_t{1});
+
+  batches_counter = (indices.size() + batch_size - 1) / batch_size;
+
+  if (batches_counter == 0) {
+    callback(self);
+    return;
+  }
+
+  // Callbacks share the snapshot through a single pointer, so that it is not held by them
+  auto snapshot = std::make_shared<population_snapshot<individual>>(make_snapshot(pop, indices));
+  auto restore = [&pop, indices, snapshot] {
+    restore_snapshot(pop, indices, *snapshot);
+  };
+
+  for (size_t begin = 0; begin < indices.size(); begin += batch_size) {
+    auto end = std::min(begin + batch_size, indices.size());
+
+    std::vector<size_t> slice(std::next(indices.begin(), begin), std::next(indices.begin(), end));
+
+    self->request(supervisor,
+                  self->state.config->system_props.request_timeout,
+                  compute_fitness::value,
+                  *snapshot,
+                  begin,
+                  end).then(
+        [=, &pop, &batches_counter](std::vector<fitness_value> &values) {
+          for (size_t i = 0; i < values.size(); ++i) {
+            pop[slice[i]].second = std::move(values[i]);
+          }
+
+          if (evaluated) {
+            evaluated->mark(slice);
+          }
+
+          if (++self->state.compute_fitness_counter == batches_counter) {
+            self->state.compute_fitness_counter = 0;
+            restore();
+            callback(self);
+          }
+        },
+        [=, &batches_counter](error &err) {
+          system_message(self,
+                         phase,
+                         ": Failed to compute fitness values for ",
+                         slice.size(),
+                         " individuals starting with: ",
+                         slice.front(),
+                         " with error code: ",
+                         err.code());
+
+          if (--batches_counter == 0) {
+            system_message(self, phase, ": Complete failure to compute fitness values, quitting...");
+            restore();
+            self->send(self, finish::value);
+          } else if (self->state.compute_fitness_counter == batches_counter) {
+            self->state.compute_fitness_counter = 0;
+            restore();
+            callback(self);
+          }
+        }
+    );
+  }
+}
+
+/*
+ * Evaluate members of main whose fitness value is not current
+ */
+template<typename individual, typename fitness_value, typename executor_actor, typename callback_type>
+void main_fitness_evaluation(executor_actor *self, const actor &supervisor, callback_type callback) {
+  auto &state = self->state;
+
+  if (!state.config->system_props.is_evaluation_tracking_active) {
+    state.evaluated.invalidate();
+  }
+
+  batch_fitness_evaluation<individual, fitness_value>(self,
+                                                      supervisor,
+                                                      state.main,
+                                                      state.evaluated.pending(state.main.size()),
+                                                      state.main_batches_counter,
+                                                      "Phase 1",
+                                                      callback,
+                                                      &state.evaluated);
+}
+
 template<typename individual, typename fitness_value,
     typename initialization_operator, typename crossover_operator,
     typename mutation_operator, typename parent_selection_operator,
@@ -211,75 +398,34 @@ behavior global_model_executor(
     }
   });
 
-  auto main_fitness_evaluation = [self, supervisor](std::function<void(decltype(self))> callback) {
-    auto &state = self->state;
-
-    state.population_size_counter = state.main.size();
-
-    for (size_t i = 0; i < state.population_size_counter; ++i) {
-      self->request(supervisor, timeout, state.main[i].first).then(
-          [=](fitness_value &fv) {
-            self->state.main[i].second = std::move(fv);
-
-            if (++self->state.compute_fitness_counter == self->state.population_size_counter) {
-              self->state.compute_fitness_counter = 0;
-              callback(self);
-            }
-          },
-          [=](error &err) {
-            system_message(self,
-                           "Phase 1: Failed to compute fitness value for individual: ",
-                           self->state.offspring[i].first,
-                           " with error code: ",
-                           err.code());
-
-            if (--self->state.population_size_counter == 0) {
-              system_message(self, "Phase 1: Complete failure to compute fitness values, quitting...");
-              self->send(self, finish::value);
-            }
-          }
-      );
-    }
-  };
-
   auto offspring_fitness_evaluation = [self, supervisor] {
     auto &state = self->state;
 
-    state.offspring_size_counter = state.offspring.size();
+    std::vector<size_t> indices(state.offspring.size());
+    std::iota(std::begin(indices), std::end(indices), size_t{});
 
-    for (size_t i = 0; i < state.offspring_size_counter; ++i) {
-      self->request(supervisor, timeout, state.offspring[i].first).then(
-          [=](fitness_value &fv) {
-            self->state.offspring[i].second = std::move(fv);
+    auto survival = [](auto self) {
+      auto &state = self->state;
 
-            if (++self->state.compute_fitness_counter == self->state.offspring_size_counter) {
-              self->state.compute_fitness_counter = 0;
-              self->state.survival_selection(self->state.main, self->state.offspring);
+      state.survival_selection(state.main, state.offspring);
 
-              self->send(self, execute_phase_3::value);
+      self->send(self, execute_phase_3::value);
 
-              generation_message(self,
-                                 note_end::value,
-                                 now(),
-                                 actor_phase::execute_phase_2,
-                                 state.current_generation,
-                                 state.current_island);
-            }
-          },
-          [=](error &err) {
-            system_message(self,
-                           "Phase 2: Failed to compute fitness value for individual: ",
-                           self->state.offspring[i].first,
-                           " with error code: ",
-                           err.code());
-
-            if (--self->state.offspring_size_counter == 0) {
-              system_message(self, "Phase 2: Complete failure to compute fitness values, quitting...");
-              self->send(self, finish::value);
-            }
-          }
-      );
-    }
+      generation_message(self,
+                         note_end::value,
+                         now(),
+                         actor_phase::execute_phase_2,
+                         state.current_generation,
+                         state.current_island);
+    };
+
+    batch_fitness_evaluation<individual, fitness_value>(self,
+                                                        supervisor,
+                                                        state.offspring,
+                                                        indices,
+                                                        state.offspring_batches_counter,
+                                                        "Phase 2",
+                                                        survival);
   };
 
   return {
@@ -290,6 +436,7 @@ behavior global_model_executor(
         generation_message(self, note_start::value, now(), state.current_island);
 
         state.initialization(std::back_inserter(state.main));
+        state.evaluated.assign(state.main.size(), false);
         self->send(self, execute_phase_1::value);
 
         generation_message(self,
@@ -299,10 +446,10 @@ behavior global_model_executor(
                            state.current_generation,
                            state.current_island);
       },
-      [self, main_fitness_evaluation](execute_phase_1) {
+      [self, supervisor](execute_phase_1) {
         generation_message(self, note_start::value, now(), self->state.current_island);
 
-        main_fitness_evaluation([](auto self) {
+        main_fitness_evaluation<individual, fitness_value>(self, supervisor, [](auto self) {
           auto &state = self->state;
 
           self->send(self, execute_phase_2::value);
@@ -358,11 +505,13 @@ behavior global_model_executor(
 
         state.main.swap(state.offspring);
         state.offspring.clear();
+        state.evaluated.assign(state.main.size(), props.is_survival_selection_active);
 
         if (props.is_elitism_active) {
           state.main.insert(state.main.end(),
                             std::make_move_iterator(state.elitists.begin()),
                             std::make_move_iterator(state.elitists.end()));
+          state.evaluated.append(state.elitists.size(), true);
           state.elitists.clear();
         }
 
@@ -382,8 +531,8 @@ behavior global_model_executor(
                            state.current_generation,
                            state.current_island);
       },
-      [self, supervisor, main_fitness_evaluation](finish) {
-        main_fitness_evaluation([supervisor](auto self) {
+      [self, supervisor](finish) {
+        main_fitness_evaluation<individual, fitness_value>(self, supervisor, [supervisor](auto self) {
           auto &state = self->state;
 
           generation_message(self,
@@ -402,5 +551,240 @@ behavior global_model_executor(
       },
   };
 }
+
+/*
+ * STEADY STATE EXECUTOR
+ *
+ * An asynchronous alternative to the executor above, used when system_properties.is_steady_state_active
+ * is set. After the initial population is evaluated there is no generation barrier: the executor keeps
+ * up to two fitness requests per worker in flight and, as soon as any of them is answered, inserts the
+ * evaluated children into main in place of its worst members and breeds further children to dispatch.
+ * A generation is accounted for every population_size children evaluated, which is when the
+ * termination check is consulted. Elitism and survival selection operators are not used, replacing
+ * the worst member keeps the best individuals in the population anyway. Once as many requests failed
+ * in a row as may be in flight at once, the executor gives up and finishes.
+ */
+template<typename individual, typename fitness_value, typename executor_actor>
+void steady_state_replacement(executor_actor *self, wrapper<individual, fitness_value> &&child) {
+  auto &main = self->state.main;
+
+  auto worst = std::min_element(std::begin(main), std::end(main), [](const auto &a, const auto &b) {
+    return a.second < b.second;
+  });
+
+  if (worst != std::end(main) && !(child.second < worst->second)) {
+    *worst = std::move(child);
+  }
+}
+
+template<typename individual, typename fitness_value, typename executor_actor>
+void steady_state_breeding(executor_actor *self, const actor &supervisor) {
+  auto &state = self->state;
+  auto &props = state.config->system_props;
+
+  auto batch_size = std::max(props.fitness_batch_size, size_t{1});
+  auto in_flight_limit = std::max(2 * props.islands_number, size_t{1});
+
+  if (state.current_generation >= props.generations_number) {
+    state.is_breeding_done = true;
+  }
+
+  while (!state.is_breeding_done && state.in_flight_counter < in_flight_limit) {
+    while (state.offspring.size() < batch_size) {
+      if (state.parents.empty()) {
+        state.parent_selection(state.main, state.parents);
+
+        if (state.parents.empty()) {
+          break;
+        }
+      }
+
+      auto first_child = state.offspring.size();
+      state.crossover(std::back_inserter(state.offspring), state.parents.back());
+      state.parents.pop_back();
+
+      for (auto i = first_child; i < state.offspring.size(); ++i) {
+        state.mutation(state.offspring[i]);
+      }
+    }
+
+    if (state.offspring.empty()) {
+      system_message(self, "Steady state: Parent selection produced no couples, quitting...");
+      state.is_breeding_done = true;
+      break;
+    }
+
+    auto count = std::min(batch_size, state.offspring.size());
+    population<individual, fitness_value> children(std::make_move_iterator(std::prev(state.offspring.end(), count)),
+                                                   std::make_move_iterator(state.offspring.end()));
+    state.offspring.resize(state.offspring.size() - count);
+
+    std::vector<individual> batch;
+    batch.reserve(children.size());
+    std::transform(std::begin(children),
+                   std::end(children),
+                   std::back_inserter(batch),
+                   [](const auto &child) { return child.first; });
+
+    ++state.in_flight_counter;
+
+    self->request(supervisor,
+                  self->state.config->system_props.request_timeout,
+                  compute_fitness::value,
+                  std::move(batch)).then(
+        [self, supervisor, children](std::vector<fitness_value> &values) {
+          auto &state = self->state;
+          auto &props = state.config->system_props;
+
+          --state.in_flight_counter;
+          state.failures_counter = 0;
+
+          for (size_t i = 0; i < values.size() && i < children.size(); ++i) {
+            steady_state_replacement<individual, fitness_value>(self, {children[i].first, std::move(values[i])});
+          }
+
+          state.children_counter += values.size();
+
+          while (!state.is_breeding_done && state.children_counter >= props.population_size) {
+            state.children_counter -= props.population_size;
+
+            generation_message(self,
+                               note_end::value,
+                               now(),
+                               actor_phase::execute_phase_2,
+                               state.current_generation,
+                               state.current_island);
+
+            if (++state.current_generation >= props.generations_number
+                || state.termination_check(state.main)) {
+              state.is_breeding_done = true;
+            } else {
+              generation_message(self, note_start::value, now(), state.current_island);
+            }
+
+            log(self, "Generations so far: ", state.current_generation);
+          }
+
+          steady_state_breeding<individual, fitness_value>(self, supervisor);
+        },
+        [self, supervisor, count, in_flight_limit](error &err) {
+          auto &state = self->state;
+
+          --state.in_flight_counter;
+
+          system_message(self,
+                         "Steady state: Failed to compute fitness values for ",
+                         count,
+                         " children with error code: ",
+                         err.code());
+
+          if (++state.failures_counter >= in_flight_limit && !state.is_breeding_done) {
+            system_message(self, "Steady state: Complete failure to compute fitness values, quitting...");
+            state.is_breeding_done = true;
+          }
+
+          steady_state_breeding<individual, fitness_value>(self, supervisor);
+        }
+    );
+  }
+
+  if (state.is_breeding_done && state.in_flight_counter == 0) {
+    state.parents.clear();
+    state.offspring.clear();
+    self->send(self, finish::value);
+  }
+}
+
+template<typename individual, typename fitness_value,
+    typename initialization_operator, typename crossover_operator,
+    typename mutation_operator, typename parent_selection_operator,
+    typename global_termination_check, typename survival_selection_operator,
+    typename elitism_operator>
+behavior global_model_steady_state_executor(
+    stateful_actor<
+    global_model_executor_state<individual, fitness_value,
+                                initialization_operator, crossover_operator, mutation_operator,
+                                parent_selection_operator, global_termination_check,
+                                survival_selection_operator, elitism_operator>> *self,
+    global_model_executor_state<individual, fitness_value,
+                                initialization_operator, crossover_operator, mutation_operator,
+                                parent_selection_operator, global_termination_check,
+                                survival_selection_operator, elitism_operator> state,
+    const actor &supervisor) {
+  self->state = std::move(state);
+  self->monitor(supervisor);
+
+  system_message(self, "Spawning global model steady state executor");
+
+  self->set_down_handler([self, supervisor](down_msg &down) {
+    if (down.source == supervisor) {
+      system_message(self, "Quitting executor as supervisor already finished");
+      self->quit();
+    }
+  });
+
+  return {
+      [self](init_population) {
+        auto &state = self->state;
+
+        generation_message(self, note_start::value, now(), state.current_island);
+        generation_message(self, note_start::value, now(), state.current_island);
+
+        state.initialization(std::back_inserter(state.main));
+        state.evaluated.assign(state.main.size(), false);
+        self->send(self, execute_phase_1::value);
+
+        generation_message(self,
+                           note_end::value,
+                           now(),
+                           actor_phase::init_population,
+                           state.current_generation,
+                           state.current_island);
+      },
+      [self, supervisor](execute_phase_1) {
+        generation_message(self, note_start::value, now(), self->state.current_island);
+
+        main_fitness_evaluation<individual, fitness_value>(self, supervisor, [](auto self) {
+          auto &state = self->state;
+
+          self->send(self, execute_phase_2::value);
+
+          generation_message(self,
+                             note_end::value,
+                             now(),
+                             actor_phase::execute_phase_1,
+                             state.current_generation,
+                             state.current_island);
+        });
+      },
+      [self, supervisor](execute_phase_2) {
+        generation_message(self, note_start::value, now(), self->state.current_island);
+
+        steady_state_breeding<individual, fitness_value>(self, supervisor);
+      },
+      [self, supervisor](finish) {
+        auto &state = self->state;
+
+        state.is_breeding_done = true;
+
+        if (state.in_flight_counter) {
+          return;
+        }
+
+        generation_message(self,
+                           note_end::value,
+                           now(),
+                           actor_phase::total,
+                           state.current_generation,
+                           state.current_island);
+        individual_message(self,
+                           report_population::value,
+                           state.main,
+                           state.current_generation,
+                           state.current_island);
+        self->send(supervisor, finish::value);
+      },
+  };
+}
 }
 }
\ No newline at end of file
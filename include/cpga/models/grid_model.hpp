@@ -1,7 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <unordered_map>
 #include "../core.hpp"
+#include "../utilities/load_tracker.hpp"
 
 namespace cpga {
 using namespace core;
@@ -20,7 +22,8 @@ struct grid_model_worker_state : public base_state {
         mutation{config, island_0},
         parent_selection{config, island_0},
         survival_selection{config, island_0},
-        elitism{config, island_0} {
+        elitism{config, island_0},
+        generator(now().time_since_epoch().count()) {
     offspring.reserve(config->system_props.population_size);
     elitists.reserve(config->system_props.elitists_number);
   }
@@ -35,6 +38,8 @@ struct grid_model_worker_state : public base_state {
   couples<individual, fitness_value> parents;
   population<individual, fitness_value> offspring;
   population<individual, fitness_value> elitists;
+  std::unordered_map<island_id, population<individual, fitness_value>> partitions;
+  std::default_random_engine generator;
 
   inline void reset() noexcept {
     parents.clear();
@@ -43,6 +48,55 @@ struct grid_model_worker_state : public base_state {
   }
 };
 
+/**
+ * @brief Breed the next generation of a population in place, evaluating the children on the way.
+ * Only the initial population arrives unevaluated, later on the individuals are evaluated by workers.
+ */
+template<typename individual, typename fitness_value, typename worker_actor>
+void grid_evolve(worker_actor *self, population<individual, fitness_value> &population, size_t gen) {
+  auto &state = self->state;
+  auto &props = state.config->system_props;
+
+  state.reset();
+
+  if (gen == 0) {
+    for (auto&[ind, value] : population) {
+      value = state.fitness_evaluation(ind);
+    }
+  }
+
+  if (props.is_elitism_active) {
+    state.elitism(population, state.elitists);
+  }
+
+  state.parent_selection(population, state.parents);
+
+  auto inserter = std::back_inserter(state.offspring);
+  for (const auto &couple : state.parents) {
+    state.crossover(inserter, couple);
+  }
+
+  state.parents.clear();
+
+  for (auto &child : state.offspring) {
+    state.mutation(child);
+    child.second = state.fitness_evaluation(child.first);
+  }
+
+  if (props.is_survival_selection_active) {
+    state.survival_selection(population, state.offspring);
+  }
+
+  population.swap(state.offspring);
+
+  if (props.is_elitism_active) {
+    population.insert(population.end(),
+                      std::make_move_iterator(state.elitists.begin()),
+                      std::make_move_iterator(state.elitists.end()));
+    state.elitists.clear();
+  }
+}
+
 template<typename individual, typename fitness_value,
     typename fitness_evaluation_operator,
     typename crossover_operator,
@@ -64,75 +118,122 @@ behavior grid_model_worker(
 
   return {
       [self](execute_computation, size_t gen, population<individual, fitness_value> &pop) {
-        auto &state = self->state;
-        auto &props = self->state.config->system_props;
-
         generation_message(self, note_start::value, now(), self->id());
 
         auto population = std::move(pop);
-        state.reset();
+        grid_evolve<individual, fitness_value>(self, population, gen);
 
-        if (props.is_elitism_active) {
-          state.elitism(population, state.elitists);
-        }
+        generation_message(self, note_end::value, now(), actor_phase::execute_computation, gen, self->id());
 
-        state.parent_selection(population, state.parents);
+        return population;
+      },
+      /*
+       * Persistent partitions: take in the individuals exchanged by other partitions, breed the next
+       * generation of the partition and send a random grid_exchange_fraction of it out for exchange
+       */
+      [self](execute_computation, size_t gen, island_id id, population<individual, fitness_value> &incoming) {
+        auto &state = self->state;
+        auto &partition = state.partitions[id];
 
-        auto inserter = std::back_inserter(state.offspring);
-        for (const auto &couple : state.parents) {
-          state.crossover(inserter, couple);
-        }
+        generation_message(self, note_start::value, now(), self->id());
 
-        state.parents.clear();
+        partition.reserve(partition.size() + incoming.size());
+        partition.insert(partition.end(),
+                         std::make_move_iterator(incoming.begin()),
+                         std::make_move_iterator(incoming.end()));
 
-        for (auto &child : state.offspring) {
-          state.mutation(child);
-        }
+        grid_evolve<individual, fitness_value>(self, partition, gen);
 
-        if (props.is_survival_selection_active) {
-          for (auto&[ind, value] : state.offspring) {
-            value = state.fitness_evaluation(ind);
-          }
+        auto count = static_cast<size_t>(state.config->system_props.grid_exchange_fraction * partition.size());
+        population<individual, fitness_value> outgoing;
+        outgoing.reserve(count);
 
-          state.survival_selection(population, state.offspring);
+        for (size_t i = 0; i < count && !partition.empty(); ++i) {
+          std::uniform_int_distribution<size_t> distribution{0, partition.size() - 1};
+          auto &chosen = partition[distribution(state.generator)];
+
+          std::swap(chosen, partition.back());
+          outgoing.emplace_back(std::move(partition.back()));
+          partition.pop_back();
         }
 
-        population.swap(state.offspring);
+        generation_message(self, note_end::value, now(), actor_phase::execute_computation, gen, self->id());
+
+        return outgoing;
+      },
+      [self](collect_partition, island_id id) {
+        auto &partitions = self->state.partitions;
+        auto partition = partitions.find(id);
 
-        if (props.is_elitism_active) {
-          population.insert(population.end(),
-                            std::make_move_iterator(state.elitists.begin()),
-                            std::make_move_iterator(state.elitists.end()));
-          state.elitists.clear();
+        if (partition == partitions.end()) {
+          return population<individual, fitness_value>{};
         }
 
-        generation_message(self, note_end::value, now(), actor_phase::execute_computation, gen, self->id());
+        auto collected = std::move(partition->second);
+        partitions.erase(partition);
 
-        return population;
+        return collected;
       },
       [self](finish_worker) {
+        statistics_message(self, self->state.fitness_evaluation);
         system_message(self, "Quitting grid model worker (id: ", self->id(), ")");
         self->quit();
       }
   };
 }
 
-struct grid_model_dispatcher_state : public base_state {
+/**
+ * @brief The state of the grid model dispatcher.
+ * @details Apart from round-robin and pull dispatch, the dispatcher can hand each batch to the worker expected
+ * to be done with it first given its outstanding individuals and measured throughput (load aware dispatch),
+ * so that slower workers are given less work.
+ * Persistent partitions are assigned to workers once, a partition whose worker died is not moved to another one.
+ */
+struct grid_model_dispatcher_state : public pull_dispatch_state {
   grid_model_dispatcher_state() = default;
   explicit grid_model_dispatcher_state(const shared_config &config, std::vector<actor> workers)
-      : base_state{config},
-        pool{workers.size()},
-        counter{0},
-        workers{std::move(workers)} {
+      : pull_dispatch_state{config, workers},
+        loads{this->workers.size()} {
+    if (!this->workers.empty()) {
+      for (island_id partition = 0; partition < config->system_props.islands_number; ++partition) {
+        partition_owners.emplace(partition, this->workers[partition % this->workers.size()]);
+      }
+    }
   }
 
-  inline auto get_worker() noexcept {
-    return workers[counter++ % pool];
+  /*
+   * Account for a batch answered by a worker, which may have died in the meantime
+   */
+  inline void release_load(const actor &worker, size_t load, bool is_completed) {
+    auto found = std::find(std::begin(workers), std::end(workers), worker);
+
+    if (found != std::end(workers)) {
+      auto i = static_cast<size_t>(std::distance(std::begin(workers), found));
+
+      if (is_completed) {
+        loads.complete(i, load, now());
+      } else {
+        loads.release(i, load);
+      }
+    }
   }
 
-  size_t pool;
-  size_t counter;
-  std::vector<actor> workers;
+  inline void remove_worker(const actor_addr &source) {
+    for (auto i = workers.size(); i-- > 0;) {
+      if (source == workers[i]) {
+        loads.remove(i);
+      }
+    }
+
+    for (auto owner = partition_owners.begin(); owner != partition_owners.end();) {
+      owner = source == owner->second ? partition_owners.erase(owner) : std::next(owner);
+    }
+
+    pull_dispatch_state::remove_worker(source);
+  }
+
+  load_tracker loads;
+  std::unordered_map<island_id, actor> partition_owners;
 };
 
 template<typename individual, typename fitness_value>
@@ -149,17 +250,90 @@ behavior grid_model_dispatcher(
 
         system_message(self, "Grid worker with actor id: ", down.source.id(), " died, respawning...");
 
-        auto &workers = self->state.workers;
-        workers.erase(std::remove_if(std::begin(workers),
-                                     std::end(workers),
-                                     [src = down.source](const auto &worker) { return src == worker; }));
-
-        self->state.pool = workers.size();
+        self->state.remove_worker(down.source);
       });
 
   return {
       [self](execute_computation atom, size_t gen, population<individual, fitness_value> &pop) {
-        self->delegate(self->state.get_worker(), atom, gen, std::move(pop));
+        auto &state = self->state;
+        auto &props = state.config->system_props;
+
+        // Only pull dispatch can hold on to a batch until a worker is available
+        if ((props.is_load_aware_dispatch_active || !props.is_pull_dispatch_active) && state.workers.empty()) {
+          self->make_response_promise().deliver(make_error(sec::request_receiver_down));
+          return;
+        }
+
+        if (props.is_load_aware_dispatch_active) {
+          auto load = pop.size();
+          auto i = state.loads.pick(load);
+          auto worker = state.workers[i];
+          auto rp = self->make_response_promise();
+
+          state.loads.assign(i, load, now());
+
+          self->request(worker, infinite, atom, gen, std::move(pop)).then(
+              [self, rp, worker, load](population<individual, fitness_value> &result) mutable {
+                self->state.release_load(worker, load, true);
+                rp.deliver(std::move(result));
+              },
+              [self, rp, worker, load](error &err) mutable {
+                self->state.release_load(worker, load, false);
+                rp.deliver(std::move(err));
+              }
+          );
+          return;
+        }
+
+        if (!props.is_pull_dispatch_active) {
+          self->delegate(state.get_worker(), atom, gen, std::move(pop));
+          return;
+        }
+
+        submit_request(self, [self, atom, gen, rp = self->make_response_promise(), pop = std::move(pop)](
+            const actor &worker, size_t id) {
+          self->request(worker, infinite, atom, gen, pop).then(
+              [self, rp, worker, id](population<individual, fitness_value> &result) mutable {
+                if (complete_request(self, id, worker)) {
+                  rp.deliver(std::move(result));
+                }
+              },
+              [self, rp, worker, id](error &err) mutable {
+                if (fail_request(self, id, worker)) {
+                  rp.deliver(std::move(err));
+                }
+              }
+          );
+        });
+      },
+      /*
+       * Persistent partitions stay with the same worker for the whole run, the partitions of a worker
+       * which died are lost
+       */
+      [self](execute_computation atom, size_t gen, island_id partition, population<individual, fitness_value> &pop) {
+        auto &owners = self->state.partition_owners;
+        auto owner = owners.find(partition);
+
+        if (owner == owners.end()) {
+          self->make_response_promise().deliver(make_error(sec::request_receiver_down));
+          return;
+        }
+
+        self->delegate(owner->second, atom, gen, partition, std::move(pop));
+      },
+      [self](collect_partition atom, island_id partition) {
+        auto &owners = self->state.partition_owners;
+        auto owner = owners.find(partition);
+
+        if (owner == owners.end()) {
+          self->make_response_promise().deliver(make_error(sec::request_receiver_down));
+          return;
+        }
+
+        self->delegate(owner->second, atom, partition);
+      },
+      [self](check_stragglers) {
+        resend_stragglers(self);
       },
       [self](finish) {
         for (const auto &worker : self->state.workers) {
@@ -172,9 +346,7 @@ behavior grid_model_dispatcher(
   };
 }
 
-template<typename individual, typename fitness_value,
-    typename initialization_operator,
-    typename fitness_evaluation_operator>
+template<typename individual, typename fitness_value, typename initialization_operator>
 struct grid_model_executor_state : public base_state {
   grid_model_executor_state() = default;
   grid_model_executor_state(const shared_config &config)
@@ -183,7 +355,6 @@ struct grid_model_executor_state : public base_state {
         computation_counter{0},
         current_generation{0},
         initialization{config, island_special},
-        fitness_evaluation{config, island_special},
         random_nums(config->system_props.population_size),
         generator(now().time_since_epoch().count()) {
     main.reserve(config->system_props.population_size);
@@ -196,26 +367,20 @@ struct grid_model_executor_state : public base_state {
   size_t current_generation;
 
   initialization_operator initialization;
-  fitness_evaluation_operator fitness_evaluation;
 
   std::vector<size_t> random_nums;
+  std::vector<size_t> exchanged;
   std::default_random_engine generator;
   population<individual, fitness_value> main;
   population<individual, fitness_value> result;
 };
 
-template<typename individual, typename fitness_value,
-    typename initialization_operator,
-    typename fitness_evaluation_operator>
+template<typename individual, typename fitness_value, typename initialization_operator>
 behavior grid_model_executor(
-    stateful_actor<
-    grid_model_executor_state<individual, fitness_value,
-                              initialization_operator, fitness_evaluation_operator>> *self,
+    stateful_actor<grid_model_executor_state<individual, fitness_value, initialization_operator>> *self,
     const shared_config &config,
     const actor &dispatcher) {
-  self->state =
-      grid_model_executor_state<individual, fitness_value, initialization_operator, fitness_evaluation_operator>{
-          config};
+  self->state = grid_model_executor_state<individual, fitness_value, initialization_operator>{config};
   self->monitor(dispatcher);
 
   system_message(self, "Spawning grid model executor");
@@ -250,34 +415,43 @@ behavior grid_model_executor(
         generation_message(self, note_start::value, now(), island_special);
 
         auto &state = self->state;
-        auto islands = props.islands_number;
+        // Load aware dispatch needs more batches than workers to be able to give slower workers fewer of them,
+        // as long as batches keep at least a couple of individuals to breed
+        auto islands = props.is_load_aware_dispatch_active
+                       ? std::max(props.islands_number,
+                                  std::min(props.islands_number * std::max(props.grid_batches_per_worker, size_t{1}),
+                                           state.main.size() / 2))
+                       : props.islands_number;
         auto generations = props.generations_number;
-        auto rem = props.population_size % props.islands_number;
-        auto times = props.population_size / props.islands_number;
+        auto rem = state.main.size() % islands;
+        auto times = state.main.size() / islands;
         auto &gen = state.generator;
         auto &random_nums = state.random_nums;
 
-        std::shuffle(random_nums.begin(), random_nums.end(), gen);
-
-        for (auto&[ind, value] : state.main) {
-          value = state.fitness_evaluation(ind);
+        if (random_nums.size() != state.main.size()) {
+          random_nums.resize(state.main.size());
+          std::iota(std::begin(random_nums), std::end(random_nums), size_t{});
         }
 
-        for (size_t i = 0; i < props.population_size; i += times) {
-          if (i + times + rem >= props.population_size) {
-            times += rem;
-          }
+        std::shuffle(random_nums.begin(), random_nums.end(), gen);
+
+        // Batches differ in size by one individual at most, the remainder is spread over the first batches
+        for (size_t i = 0, begin = 0; i < islands; ++i) {
+          auto end = begin + times + (i < rem ? 1 : 0);
 
           population<individual, fitness_value> pop;
-          for (size_t j = i; j < i + times; ++j) {
+          pop.reserve(end - begin);
+          for (size_t j = begin; j < end; ++j) {
             pop.emplace_back(std::move(state.main[random_nums[j]]));
           }
 
+          begin = end;
+
           state.computation_counter = islands;
 
           self->request(
               dispatcher,
-              timeout,
+              props.request_timeout,
               execute_computation::value,
               self->state.current_generation,
               pop
@@ -326,10 +500,6 @@ behavior grid_model_executor(
       [=](execute_phase_2) {
         auto &state = self->state;
 
-        for (auto&[ind, value] : state.main) {
-          value = state.fitness_evaluation(ind);
-        }
-
         generation_message(self, note_end::value, now(), actor_phase::total, state.current_generation, island_special);
         individual_message(self, report_population::value, state.main, state.current_generation, island_special);
 
@@ -337,5 +507,193 @@ behavior grid_model_executor(
       },
   };
 }
+
+/*
+ * PERSISTENT PARTITIONS EXECUTOR
+ *
+ * An alternative to the executor above, used when system_properties.is_grid_partition_persistent is set.
+ * The population is split into islands_number partitions once, each kept by the same worker for the whole run.
+ * Every generation a worker sends back only grid_exchange_fraction of its partition, the executor shuffles
+ * these individuals and hands each partition as many as it sent out in the next generation. The partitions
+ * are collected back once the last generation is done.
+ */
+template<typename individual, typename fitness_value, typename initialization_operator>
+behavior grid_model_persistent_executor(
+    stateful_actor<grid_model_executor_state<individual, fitness_value, initialization_operator>> *self,
+    const shared_config &config,
+    const actor &dispatcher) {
+  self->state = grid_model_executor_state<individual, fitness_value, initialization_operator>{config};
+  self->monitor(dispatcher);
+
+  system_message(self, "Spawning grid model persistent partitions executor");
+
+  self->set_down_handler([self, dispatcher](down_msg &down) {
+    if (down.source == dispatcher) {
+      system_message(self, "Quitting executor as dispatcher already finished");
+      self->quit();
+    }
+  });
+
+  const auto &props = self->state.config->system_props;
+
+  /*
+   * Advance once every partition has answered, either with its outgoing individuals or with an error
+   */
+  auto on_computation_done = [self, generations = props.generations_number] {
+    auto &state = self->state;
+
+    if (state.computation_done < state.computation_counter) {
+      return;
+    }
+
+    state.computation_done = 0;
+
+    generation_message(self,
+                       note_end::value,
+                       now(),
+                       actor_phase::execute_phase_1,
+                       state.current_generation,
+                       island_special);
+
+    if (state.computation_counter && ++state.current_generation <= generations) {
+      self->send(self, execute_phase_1::value);
+    } else {
+      self->send(self, execute_phase_2::value);
+    }
+
+    log(self, "Generations so far: ", state.current_generation);
+  };
+
+  return {
+      [=](init_population) {
+        auto &state = self->state;
+        auto partitions = props.islands_number;
+
+        generation_message(self, note_start::value, now(), island_special);
+        generation_message(self, note_start::value, now(), island_special);
+
+        state.initialization(std::back_inserter(state.result));
+
+        state.exchanged.assign(partitions, state.result.size() / partitions);
+        for (size_t i = 0; i < state.result.size() % partitions; ++i) {
+          ++state.exchanged[i];
+        }
+
+        self->send(self, execute_phase_1::value);
+
+        generation_message(self,
+                           note_end::value,
+                           now(),
+                           actor_phase::init_population,
+                           state.current_generation,
+                           island_special);
+      },
+      [=](execute_phase_1) {
+        generation_message(self, note_start::value, now(), island_special);
+
+        auto &state = self->state;
+        auto partitions = state.exchanged.size();
+
+        std::shuffle(state.result.begin(), state.result.end(), state.generator);
+
+        std::vector<population<individual, fitness_value>> incoming(partitions);
+        auto begin = state.result.begin();
+        for (size_t i = 0; i < partitions; ++i) {
+          auto end = std::next(begin, std::min(state.exchanged[i],
+                                               static_cast<size_t>(std::distance(begin, state.result.end()))));
+          incoming[i].assign(std::make_move_iterator(begin), std::make_move_iterator(end));
+          begin = end;
+        }
+        state.result.clear();
+
+        state.computation_counter = partitions;
+
+        for (size_t i = 0; i < partitions; ++i) {
+          self->request(
+              dispatcher,
+              props.request_timeout,
+              execute_computation::value,
+              state.current_generation,
+              island_id{i},
+              std::move(incoming[i])
+          ).then(
+              [self, i, on_computation_done](population<individual, fitness_value> &outgoing) {
+                auto &state = self->state;
+
+                state.exchanged[i] = outgoing.size();
+                state.result.insert(state.result.end(),
+                                    std::make_move_iterator(outgoing.begin()),
+                                    std::make_move_iterator(outgoing.end()));
+
+                ++state.computation_done;
+                on_computation_done();
+              },
+              [self, i, on_computation_done](error &err) {
+                system_message(self,
+                               "Failed to execute computation for partition no: ",
+                               i,
+                               " with error code: ",
+                               err.code());
+
+                self->state.exchanged[i] = 0;
+
+                if (--self->state.computation_counter == 0) {
+                  system_message(self, "Complete failure to perform computations, quitting...");
+                }
+
+                on_computation_done();
+              }
+          );
+        }
+      },
+      /*
+       * Collect the partitions along with the individuals still awaiting exchange
+       */
+      [=](execute_phase_2) {
+        auto &state = self->state;
+        auto partitions = state.exchanged.size();
+
+        state.main.clear();
+        state.main.insert(state.main.end(),
+                          std::make_move_iterator(state.result.begin()),
+                          std::make_move_iterator(state.result.end()));
+        state.result.clear();
+        state.computation_counter = partitions;
+
+        auto on_collected = [self, dispatcher] {
+          auto &state = self->state;
+
+          if (++state.computation_done < state.computation_counter) {
+            return;
+          }
+
+          generation_message(self,
+                             note_end::value,
+                             now(),
+                             actor_phase::total,
+                             state.current_generation,
+                             island_special);
+          individual_message(self, report_population::value, state.main, state.current_generation, island_special);
+
+          self->send(dispatcher, finish::value);
+        };
+
+        for (size_t i = 0; i < partitions; ++i) {
+          self->request(dispatcher, props.request_timeout, collect_partition::value, island_id{i}).then(
+              [self, on_collected](population<individual, fitness_value> &partition) {
+                self->state.main.insert(self->state.main.end(),
+                                        std::make_move_iterator(partition.begin()),
+                                        std::make_move_iterator(partition.end()));
+                on_collected();
+              },
+              [self, i, on_collected](error &err) {
+                system_message(self, "Failed to collect partition no: ", i, " with error code: ", err.code());
+                on_collected();
+              }
+          );
+        }
+      },
+  };
+}
 }
 }
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <numeric>
 #include <random>
 #include <chrono>
 #include <thread>
 #include "../core.hpp"
+#include "../utilities/evaluation_bitmap.hpp"
+#include "../utilities/population_balancer.hpp"
+#include "../utilities/migration_controller.hpp"
+#include "global_model.hpp"
 
 namespace cpga {
 using namespace core;
@@ -22,7 +27,7 @@ template<typename individual, typename fitness_value,
 struct island_model_worker_state : public base_state {
   island_model_worker_state() = default;
 
-  island_model_worker_state(const shared_config &config, island_id id)
+  island_model_worker_state(const shared_config &config, island_id id, const actor &evaluators)
       : base_state{config},
         initialization{config, id},
         fitness_evaluation{config, id},
@@ -33,7 +38,10 @@ struct island_model_worker_state : public base_state {
         survival_selection{config, id},
         elitism{config, id},
         current_island{id},
-        current_generation{0} {
+        current_generation{0},
+        batches_counter{0},
+        busy_time{0},
+        evaluators{evaluators} {
     main.reserve(
         config->system_props.population_size
             + config->system_props.elitists_number);
@@ -52,13 +60,223 @@ struct island_model_worker_state : public base_state {
 
   island_id current_island;
   size_t current_generation;
+  size_t batches_counter;
+
+  /**
+   * @brief The time spent on generations since the island last reported its load, used to rebalance
+   * populations between islands (system_properties.is_island_rebalancing_active).
+   */
+  std::chrono::nanoseconds busy_time;
+  std::chrono::high_resolution_clock::time_point generation_started;
+
+  /**
+   * @brief Routing table of all islands indexed by their island_id, migrants are sent to their
+   * destinations directly.
+   */
+  std::vector<actor> peers;
+
+  /**
+   * @brief The supervisor of the evaluator pool shared by islands of this machine in hybrid mode
+   * (system_properties.island_evaluators_number > 0), invalid otherwise.
+   */
+  actor evaluators;
 
   couples<individual, fitness_value> parents;
   population<individual, fitness_value> main;
   population<individual, fitness_value> offspring;
   population<individual, fitness_value> elitists;
+  evaluation_bitmap evaluated;
 };
 
+/*
+ * Evaluate the given members of a population and execute the callback afterwards.
+ * Without an evaluator pool the island evaluates them itself, otherwise slices of
+ * fitness_batch_size members are sent to the pool and the island awaits the fitness
+ * values, postponing other messages until the callback is done. Slices the pool fails
+ * to evaluate are evaluated by the island. The individuals are moved into a snapshot
+ * for the pool and given back before the callback.
+ */
+template<typename individual, typename fitness_value, typename Actor, typename Callback>
+void island_fitness_evaluation(Actor *self,
+                               population<individual, fitness_value> &pop,
+                               const std::vector<size_t> &indices,
+                               Callback callback) {
+  auto &state = self->state;
+  auto &props = state.config->system_props;
+
+  if (!state.evaluators || indices.empty()) {
+    for (auto i : indices) {
+      pop[i].second = state.fitness_evaluation(pop[i].first);
+    }
+
+    callback(self);
+    return;
+  }
+
+  auto batch_size = std::max(props.fitness_batch_size, size_t{1});
+  // Callbacks share the snapshot through a single pointer, so that it is not held by them
+  auto snapshot = std::make_shared<population_snapshot<individual>>(make_snapshot(pop, indices));
+  auto restore = [&pop, indices, snapshot] {
+    restore_snapshot(pop, indices, *snapshot);
+  };
+
+  state.batches_counter = (indices.size() + batch_size - 1) / batch_size;
+
+  for (size_t begin = 0; begin < indices.size(); begin += batch_size) {
+    auto end = std::min(begin + batch_size, indices.size());
+
+    std::vector<size_t> slice(std::next(indices.begin(), begin), std::next(indices.begin(), end));
+
+    self->request(state.evaluators, props.request_timeout, compute_fitness::value, *snapshot, begin, end).await(
+        [self, &pop, slice, restore, callback](std::vector<fitness_value> &values) mutable {
+          for (size_t i = 0; i < values.size(); ++i) {
+            pop[slice[i]].second = std::move(values[i]);
+          }
+
+          if (--self->state.batches_counter == 0) {
+            restore();
+            callback(self);
+          }
+        },
+        [self, &pop, slice, begin, snapshot, restore, callback](error &err) mutable {
+          system_message(self,
+                         "Island ",
+                         self->state.current_island,
+                         ": Evaluator pool failed to compute fitness values for ",
+                         slice.size(),
+                         " individuals with error code: ",
+                         err.code(),
+                         ", evaluating them locally");
+
+          // The individuals are still in the snapshot
+          for (size_t i = 0; i < slice.size(); ++i) {
+            pop[slice[i]].second = self->state.fitness_evaluation((*snapshot->individuals)[begin + i]);
+          }
+
+          if (--self->state.batches_counter == 0) {
+            restore();
+            callback(self);
+          }
+        }
+    );
+  }
+}
+
+/*
+ * Group migrants by their destination island, so that each destination receives
+ * all of its migrants in a single message. Migrants bound for unknown islands are dropped.
+ */
+template<typename individual, typename fitness_value>
+std::vector<population<individual, fitness_value>> coalesce_migrants(
+    migration_payload<individual, fitness_value> &payload, size_t islands) {
+  std::vector<size_t> counts(islands);
+  for (const auto &migrant : payload) {
+    if (migrant.first < islands) {
+      ++counts[migrant.first];
+    }
+  }
+
+  std::vector<population<individual, fitness_value>> destinations(islands);
+  for (size_t i = 0; i < islands; ++i) {
+    destinations[i].reserve(counts[i]);
+  }
+
+  for (auto&[island_id, migrant] : payload) {
+    if (island_id < islands) {
+      destinations[island_id].emplace_back(std::move(migrant));
+    }
+  }
+
+  return destinations;
+}
+
+/*
+ * Send migrants straight to their destination islands and execute the callback once
+ * every destination acknowledged its migrants (or failed to). Every delivery counts its own
+ * acknowledgements, as deliveries may overlap, and migrants a destination failed to receive
+ * are put back into main
+ */
+template<typename individual, typename fitness_value, typename Actor, typename Callback>
+void deliver_migrants(Actor *self, migration_payload<individual, fitness_value> &payload, Callback callback) {
+  auto &state = self->state;
+  auto destinations = coalesce_migrants(payload, state.peers.size());
+  auto pending = std::make_shared<size_t>(0);
+
+  for (size_t island_id = 0; island_id < destinations.size(); ++island_id) {
+    if (destinations[island_id].empty()) {
+      continue;
+    }
+
+    ++*pending;
+
+    auto migrants = std::make_shared<population<individual, fitness_value>>(std::move(destinations[island_id]));
+
+    self->request(state.peers[island_id], infinite, receive_migration::value, *migrants).then(
+        [self, callback, pending](bool) mutable {
+          if (--*pending == 0) {
+            callback(self);
+          }
+        },
+        [self, callback, pending, migrants, island_id](error &err) mutable {
+          auto &state = self->state;
+
+          system_message(self, "Island ", state.current_island, ": Failed to deliver migrants to island ",
+                         island_id, " with error code: ", err.code());
+
+          state.main.insert(state.main.end(),
+                            std::make_move_iterator(migrants->begin()),
+                            std::make_move_iterator(migrants->end()));
+          state.evaluated.append(migrants->size(), true);
+
+          if (--*pending == 0) {
+            callback(self);
+          }
+        }
+    );
+  }
+
+  if (*pending == 0) {
+    callback(self);
+  }
+}
+
+/*
+ * Choose migrants from main, at most quota of them unless the migration operator
+ * only takes system_properties.migration_quota into account
+ */
+template<typename individual, typename fitness_value, typename State>
+migration_payload<individual, fitness_value> choose_migrants(State &state, size_t quota) {
+  if constexpr (std::is_invocable_v<decltype(state.migration) &,
+                                    island_id,
+                                    population<individual, fitness_value> &,
+                                    size_t>) {
+    return state.migration(state.current_island, state.main, quota);
+  } else {
+    return state.migration(state.current_island, state.main);
+  }
+}
+
+/*
+ * Evaluate members of main whose fitness value is not current
+ */
+template<typename individual, typename fitness_value, typename Actor, typename Callback>
+void island_main_fitness_evaluation(Actor *self, Callback callback) {
+  auto &state = self->state;
+
+  if (!state.config->system_props.is_evaluation_tracking_active) {
+    state.evaluated.invalidate();
+  }
+
+  island_fitness_evaluation<individual, fitness_value>(self,
+                                                       state.main,
+                                                       state.evaluated.pending(state.main.size()),
+                                                       [callback](auto self) mutable {
+                                                         self->state.evaluated.assign(self->state.main.size(),
+                                                                                      true);
+                                                         callback(self);
+                                                       });
+}
+
 template<typename individual, typename fitness_value,
     typename fitness_evaluation_operator,
     typename initialization_operator,
@@ -74,7 +292,149 @@ behavior island_model_worker(
                               fitness_evaluation_operator, initialization_operator,
                               crossover_operator, mutation_operator, parent_selection_operator,
                               survival_selection_operator, elitism_operator, migration_operator>> *self,
-    const shared_config &config) {
+    const shared_config &config,
+    const actor &evaluators) {
+  auto replacement = [](auto self) {
+    auto &state = self->state;
+    auto &props = self->state.config->system_props;
+
+    state.main.swap(state.offspring);
+    state.offspring.clear();
+    state.evaluated.assign(state.main.size(), props.is_survival_selection_active);
+
+    if (props.is_elitism_active) {
+      state.main.insert(state.main.end(),
+                        std::make_move_iterator(state.elitists.begin()),
+                        std::make_move_iterator(state.elitists.end()));
+      state.evaluated.append(state.elitists.size(), true);
+      state.elitists.clear();
+    }
+
+    ++state.current_generation;
+  };
+
+  /*
+   * Note the end of the generation, or of the epoch of generations, timed since state.generation_started
+   */
+  auto generation_done = [](auto self, actor_phase phase) {
+    auto &state = self->state;
+
+    generation_message(self, note_end::value, now(), phase, state.current_generation - 1, state.current_island);
+
+    state.busy_time += now() - state.generation_started;
+  };
+
+  auto breeding = [replacement](auto self, auto next) {
+    auto &state = self->state;
+    auto &props = self->state.config->system_props;
+
+    if (props.is_elitism_active) {
+      state.elitism(state.main, state.elitists);
+    }
+
+    state.parent_selection(state.main, state.parents);
+
+    for (const auto &couple : state.parents) {
+      state.crossover(std::back_inserter(state.offspring), couple);
+    }
+
+    state.parents.clear();
+
+    for (auto &child : state.offspring) {
+      state.mutation(child);
+    }
+
+    if (props.is_survival_selection_active) {
+      std::vector<size_t> indices(state.offspring.size());
+      std::iota(std::begin(indices), std::end(indices), size_t{});
+
+      auto survival = [replacement, next](auto self) {
+        self->state.survival_selection(self->state.main, self->state.offspring);
+        replacement(self);
+        next(self);
+      };
+
+      island_fitness_evaluation<individual, fitness_value>(self, state.offspring, indices, survival);
+    } else {
+      replacement(self);
+      next(self);
+    }
+  };
+
+  /*
+   * In asynchronous mode an island moves on to its next generation by itself, sending
+   * migrants to their destinations whenever its own migration period elapses
+   */
+  auto advance = [generation_done](auto self) {
+    auto &state = self->state;
+    auto &props = self->state.config->system_props;
+
+    generation_done(self, actor_phase::execute_generation);
+
+    auto next = [](auto self) {
+      if (self->state.current_generation < self->state.config->system_props.generations_number) {
+        self->send(self, execute_evolution::value);
+      } else {
+        self->send(self, finish::value);
+      }
+    };
+
+    if (props.is_migration_active
+        && props.migration_period
+        && state.current_generation % props.migration_period == 0
+        && state.current_generation < props.generations_number) {
+      island_main_fitness_evaluation<individual, fitness_value>(self, [next](auto self) {
+        auto &state = self->state;
+
+        auto payload = state.migration(state.current_island, state.main);
+        state.evaluated.assign(state.main.size(), true);
+
+        auto destinations = coalesce_migrants(payload, state.peers.size());
+        for (size_t island_id = 0; island_id < destinations.size(); ++island_id) {
+          if (!destinations[island_id].empty()) {
+            self->send(state.peers[island_id], receive_migration::value, std::move(destinations[island_id]));
+          }
+        }
+
+        next(self);
+      });
+    } else {
+      next(self);
+    }
+  };
+
+  /*
+   * Run an epoch of the given number of generations in a row, without going through the mailbox
+   * in between. Generations follow each other in a plain loop unless fitness values are computed by
+   * evaluators, in which case every generation goes on from the callback of the previous one
+   */
+  auto epoch = [breeding, generation_done](auto self, size_t generations) {
+    auto step = [breeding, generation_done](auto self, size_t left, auto step) -> void {
+      island_main_fitness_evaluation<individual, fitness_value>(self, [=](auto self) {
+        breeding(self, [=](auto self) {
+          if (left > 1) {
+            step(self, left - 1, step);
+          } else {
+            generation_done(self, actor_phase::execute_epoch);
+          }
+        });
+      });
+    };
+
+    if (self->state.evaluators) {
+      step(self, generations, step);
+      return;
+    }
+
+    for (size_t i = 0; i < generations; ++i) {
+      island_main_fitness_evaluation<individual, fitness_value>(self, [breeding](auto self) {
+        breeding(self, [](auto) {});
+      });
+    }
+
+    generation_done(self, actor_phase::execute_epoch);
+  };
+
   message_handler main_behavior{
       [self](init_population) {
         auto &state = self->state;
@@ -83,80 +443,133 @@ behavior island_model_worker(
         generation_message(self, note_start::value, now(), state.current_island);
 
         state.initialization(std::back_inserter(state.main));
+        state.evaluated.assign(state.main.size(), false);
 
         generation_message(self, note_end::value, now(), actor_phase::init_population, state.current_generation,
                            state.current_island);
       },
-      [self](execute_generation) {
-        auto &state = self->state;
-        auto &props = self->state.config->system_props;
-
-        generation_message(self, note_start::value, now(), state.current_island);
+      [self, breeding, generation_done](execute_generation) {
+        generation_message(self, note_start::value, now(), self->state.current_island);
+        self->state.generation_started = now();
 
-        for (auto&[ind, value] : state.main) {
-          value = state.fitness_evaluation(ind);
+        island_main_fitness_evaluation<individual, fitness_value>(self, [breeding, generation_done](auto self) {
+          breeding(self, [generation_done](auto self) {
+            generation_done(self, actor_phase::execute_generation);
+          });
+        });
+      },
+      [self, epoch](execute_generation, size_t generations) {
+        if (!generations) {
+          return;
         }
 
-        if (props.is_elitism_active) {
-          state.elitism(state.main, state.elitists);
-        }
+        generation_message(self, note_start::value, now(), self->state.current_island);
+        self->state.generation_started = now();
 
-        state.parent_selection(state.main, state.parents);
+        epoch(self, generations);
+      },
+      [self, breeding, advance](execute_evolution) {
+        generation_message(self, note_start::value, now(), self->state.current_island);
+        self->state.generation_started = now();
 
-        for (const auto &couple : state.parents) {
-          state.crossover(std::back_inserter(state.offspring), couple);
-        }
+        island_main_fitness_evaluation<individual, fitness_value>(self, [breeding, advance](auto self) {
+          breeding(self, advance);
+        });
+      },
+      /*
+       * Migrants are delivered before the dispatcher is answered, so that they
+       * are in place once the next generation is executed
+       */
+      [self](execute_migration, size_t quota) -> result<bool> {
+        auto rp = self->template make_response_promise<bool>();
 
-        state.parents.clear();
+        // Migrants are chosen and travel with their fitness values, so these have to be current
+        island_main_fitness_evaluation<individual, fitness_value>(self, [rp, quota](auto self) mutable {
+          auto &state = self->state;
 
-        for (auto &child : state.offspring) {
-          state.mutation(child);
-        }
+          auto payload = choose_migrants<individual, fitness_value>(state, quota);
+          state.evaluated.assign(state.main.size(), true);
 
-        if (props.is_survival_selection_active) {
-          for (auto &[ind, value] : state.offspring) {
-            value = state.fitness_evaluation(ind);
-          }
+          deliver_migrants(self, payload, [rp](auto) mutable {
+            rp.deliver(true);
+          });
+        });
 
-          state.survival_selection(state.main, state.offspring);
-        }
+        return rp;
+      },
+      /*
+       * Report statistics of main for the termination check, evaluating members whose fitness value is not current
+       */
+      [self](collect_statistics) -> result<fitness_statistics<fitness_value>> {
+        auto rp = self->template make_response_promise<fitness_statistics<fitness_value>>();
 
-        state.main.swap(state.offspring);
-        state.offspring.clear();
+        island_main_fitness_evaluation<individual, fitness_value>(self, [rp](auto self) mutable {
+          rp.deliver(make_statistics(self->state.main));
+        });
 
-        if (props.is_elitism_active) {
-          state.main.insert(state.main.end(),
-                            std::make_move_iterator(state.elitists.begin()),
-                            std::make_move_iterator(state.elitists.end()));
-          state.elitists.clear();
-        }
+        return rp;
+      },
+      /*
+       * Report the population size and the time spent on generations since the previous report
+       */
+      [self](report_load) {
+        auto &state = self->state;
+        auto busy_time = static_cast<size_t>(state.busy_time.count());
 
-        generation_message(self, note_end::value, now(), actor_phase::execute_generation,
-                           self->state.current_generation, self->state.current_island);
+        state.busy_time = std::chrono::nanoseconds{0};
 
-        ++state.current_generation;
+        return std::make_tuple(state.main.size(), busy_time);
       },
-      [self](execute_migration) {
-        return self->state.migration(self->state.current_island, self->state.main);
+      /*
+       * Hand count members of main over to another island, their fitness values have to be current
+       */
+      [self](rebalance_population, island_id destination, size_t count) -> result<bool> {
+        auto rp = self->template make_response_promise<bool>();
+
+        island_main_fitness_evaluation<individual, fitness_value>(self, [rp, destination, count](auto self) mutable {
+          auto &state = self->state;
+          auto first = std::next(state.main.begin(), std::min(count, state.main.size()));
+
+          migration_payload<individual, fitness_value> payload;
+          payload.reserve(std::distance(state.main.begin(), first));
+          std::transform(std::make_move_iterator(state.main.begin()),
+                         std::make_move_iterator(first),
+                         std::back_inserter(payload),
+                         [destination](auto &&member) { return std::make_pair(destination, std::move(member)); });
+
+          state.main.erase(state.main.begin(), first);
+          state.evaluated.assign(state.main.size(), true);
+
+          deliver_migrants(self, payload, [rp](auto) mutable {
+            rp.deliver(true);
+          });
+        });
+
+        return rp;
       },
-      [self](receive_migration, wrapper<individual, fitness_value> &migrant) {
-        self->state.main.emplace_back(std::move(migrant));
+      [self](receive_migration, population<individual, fitness_value> &migrants) {
+        auto &main = self->state.main;
+
+        main.reserve(main.size() + migrants.size());
+        main.insert(main.end(), std::make_move_iterator(migrants.begin()), std::make_move_iterator(migrants.end()));
+        self->state.evaluated.append(migrants.size(), true);
+
+        return true;
       },
       [self](finish) {
-        auto &state = self->state;
+        island_main_fitness_evaluation<individual, fitness_value>(self, [](auto self) {
+          auto &state = self->state;
 
-        for (auto&[ind, value] : state.main) {
-          value = state.fitness_evaluation(ind);
-        }
-
-        generation_message(self, note_end::value, now(), actor_phase::total, state.current_generation,
-                           state.current_island);
-        individual_message(self, report_population::value, state.main, state.current_generation,
-                           state.current_island);
-        system_message(self, "Quitting island worker id: ", state.current_island);
-        bus_message(self, "worker_finished");
+          generation_message(self, note_end::value, now(), actor_phase::total, state.current_generation,
+                             state.current_island);
+          individual_message(self, report_population::value, state.main, state.current_generation,
+                             state.current_island);
+          statistics_message(self, state.fitness_evaluation);
+          system_message(self, "Quitting island worker id: ", state.current_island);
+          bus_message(self, "worker_finished");
 
-        self->quit();
+          self->quit();
+        });
       }
   };
 
@@ -165,18 +578,69 @@ behavior island_model_worker(
   });
 
   return {
-      [=](assign_id, island_id id) {
+      [=](assign_id, island_id id, const std::vector<actor> &peers) {
         self->state = island_model_worker_state<individual, fitness_value,
                                                 fitness_evaluation_operator, initialization_operator,
                                                 crossover_operator, mutation_operator, parent_selection_operator,
                                                 survival_selection_operator, elitism_operator, migration_operator>{
-            config, id};
+            config, id, evaluators};
+        self->state.peers = peers;
 
         self->become(main_behavior);
       }
   };
 }
 
+/*
+ * EVALUATOR POOL
+ *
+ * In hybrid mode (system_properties.island_evaluators_number > 0) islands running on a machine
+ * farm out their fitness evaluations to a shared pool of global model workers behind a
+ * global model supervisor. The guard finishes the pool once all islands it serves are down.
+ */
+template<typename individual, typename fitness_value, typename fitness_evaluation_operator, typename Actor>
+actor spawn_island_evaluators(Actor &&self, const shared_config &config) {
+  std::vector<actor> workers(config->system_props.island_evaluators_number);
+  auto spawn_worker = [&] {
+    return self->template spawn<detached + monitored>(global_model_worker<individual,
+                                                                          fitness_value,
+                                                                          fitness_evaluation_operator>,
+                                                      config);
+  };
+  std::generate(std::begin(workers), std::end(workers), spawn_worker);
+
+  return self->template spawn<detached>(global_model_supervisor<individual, fitness_value>,
+                                        global_model_supervisor_state{config, workers});
+}
+
+struct island_evaluators_guard_state {
+  size_t islands_running;
+};
+
+inline behavior island_evaluators_guard(stateful_actor<island_evaluators_guard_state> *self,
+                                        const actor &evaluators,
+                                        const std::vector<actor> &islands) {
+  self->state.islands_running = islands.size();
+
+  for (const auto &island : islands) {
+    self->monitor(island);
+  }
+
+  self->set_down_handler([self, evaluators](down_msg &) {
+    if (--self->state.islands_running == 0) {
+      self->send(evaluators, finish::value);
+      self->quit();
+    }
+  });
+
+  return {
+      [self, evaluators](finish) {
+        self->send(evaluators, finish::value);
+        self->quit();
+      }
+  };
+}
+
 struct island_model_dispatcher_state : public base_state {
   island_model_dispatcher_state() = default;
 
@@ -203,10 +667,99 @@ struct island_model_dispatcher_state : public base_state {
   std::unordered_map<actor_id, island_id> actor_to_island;
 };
 
-template<typename T, typename A>
-inline void forward(stateful_actor<T> *self, A &&atom) {
+template<typename T, typename... Ts>
+inline void forward(stateful_actor<T> *self, const Ts &... xs) {
   for (const auto &island : self->state.islands) {
-    self->send(island.second, std::forward<A>(atom));
+    self->send(island.second, xs...);
+  }
+}
+
+/*
+ * REBALANCING
+ *
+ * When system_properties.is_island_rebalancing_active is set, the dispatcher asks islands after every
+ * migration for their population sizes and the time they spent on generations since, then moves individuals
+ * from slow islands to fast ones, so that islands take about the same time per generation and fast ones
+ * do not idle at the next migration. The callback is executed once all transfers are done.
+ */
+struct island_loads {
+  std::vector<island_id> ids;
+  std::vector<size_t> sizes;
+  std::vector<std::chrono::nanoseconds> times;
+  size_t pending;
+};
+
+template<typename Callback>
+void transfer_individuals(stateful_actor<island_model_dispatcher_state> *self,
+                          const island_loads &loads,
+                          Callback callback) {
+  auto &props = self->state.config->system_props;
+  auto transfers = plan_population_transfers(loads.sizes, loads.times, props.elitists_number + 2);
+  auto pending = std::make_shared<size_t>(transfers.size());
+
+  if (transfers.empty()) {
+    callback();
+    return;
+  }
+
+  for (const auto &transfer : transfers) {
+    auto from = loads.ids[transfer.from];
+    auto to = loads.ids[transfer.to];
+
+    system_message(self, "Rebalancing: moving ", transfer.count, " individuals from island ", from, " to island ", to);
+
+    self->request(self->state.islands[from], infinite, rebalance_population::value, to, transfer.count).then(
+        [=](bool) mutable {
+          if (--*pending == 0) {
+            callback();
+          }
+        },
+        [=](error &err) mutable {
+          system_message(self, "Failed to rebalance island: ", from, " with error code: ", err.code());
+
+          if (--*pending == 0) {
+            callback();
+          }
+        }
+    );
+  }
+}
+
+template<typename Callback>
+void rebalance_islands(stateful_actor<island_model_dispatcher_state> *self, Callback callback) {
+  auto &islands = self->state.islands;
+  auto loads = std::make_shared<island_loads>();
+
+  loads->sizes.resize(islands.size());
+  loads->times.resize(islands.size());
+  loads->pending = islands.size();
+
+  if (islands.empty()) {
+    callback();
+    return;
+  }
+
+  for (const auto&[id, worker] : islands) {
+    auto index = loads->ids.size();
+    loads->ids.push_back(id);
+
+    self->request(worker, infinite, report_load::value).then(
+        [=](size_t size, size_t busy_time) mutable {
+          loads->sizes[index] = size;
+          loads->times[index] = std::chrono::nanoseconds(busy_time);
+
+          if (--loads->pending == 0) {
+            transfer_individuals(self, *loads, callback);
+          }
+        },
+        [=](error &err) mutable {
+          system_message(self, "Failed to collect load of island: ", id, " with error code: ", err.code());
+
+          if (--loads->pending == 0) {
+            transfer_individuals(self, *loads, callback);
+          }
+        }
+    );
   }
 }
 
@@ -222,9 +775,17 @@ behavior island_model_dispatcher(
   system_message(self, "Spawning island model dispatcher");
 
   auto islands = self->state.config->system_props.islands_number;
+
+  std::vector<actor> peers(self->state.islands.size());
+  for (const auto&[id, worker] : self->state.islands) {
+    if (id < peers.size()) {
+      peers[id] = worker;
+    }
+  }
+
   for (const auto&[id, worker] : self->state.islands) {
     self->monitor(worker);
-    self->send(worker, assign_id::value, id);
+    self->send(worker, assign_id::value, id, peers);
   }
 
   /*
@@ -254,29 +815,34 @@ behavior island_model_dispatcher(
       [self](execute_generation atom) {
         forward(self, atom);
       },
+      [self](execute_generation atom, size_t generations) {
+        forward(self, atom, generations);
+      },
+      [self](execute_evolution atom) {
+        forward(self, atom);
+      },
       /*
-       * Run the migration step, that is request migrants from islands and
-       * route them to their destinations, then notify the executor by
-       * delivering the response promise.
+       * Run the migration step, that is ask islands to send migrants straight
+       * to their destinations and, once every island reports its migrants
+       * delivered, notify the executor by delivering the response promise.
        */
-      [self, islands](execute_migration atom) -> result<bool> {
+      [self, islands](execute_migration atom, size_t quota) -> result<bool> {
         self->state.migrations_counter = islands;
 
         auto rp = self->make_response_promise<bool>();
         for (const auto&[id, worker] : self->state.islands) {
-          self->request(worker, infinite, atom).then(
-              [=](const migration_payload<individual, fitness_value> &payload) mutable {
-                auto &islands = self->state.islands;
-
-                for (auto&[island_id, migrant] : payload) {
-                  if (auto island{islands.find(island_id)}; island != islands.end()) {
-                    self->send(island->second, receive_migration::value, std::move(migrant));
-                  }
-                }
-
+          self->request(worker, infinite, atom, quota).then(
+              [=](bool) mutable {
                 if (++self->state.migrations_done == self->state.migrations_counter) {
                   self->state.migrations_done = 0;
-                  rp.deliver(true);
+
+                  if (self->state.config->system_props.is_island_rebalancing_active) {
+                    rebalance_islands(self, [rp]() mutable {
+                      rp.deliver(true);
+                    });
+                  } else {
+                    rp.deliver(true);
+                  }
                 }
               },
               [=](error &err) mutable {
@@ -294,6 +860,44 @@ behavior island_model_dispatcher(
 
         return rp;
       },
+      /*
+       * Gather fitness statistics of all islands, indexed by island id. Statistics of islands
+       * which are down or failed to answer are empty
+       */
+      [self, islands](collect_statistics atom) -> result<std::vector<fitness_statistics<fitness_value>>> {
+        auto rp = self->make_response_promise<std::vector<fitness_statistics<fitness_value>>>();
+        auto statistics = std::make_shared<std::vector<fitness_statistics<fitness_value>>>(
+            islands, fitness_statistics<fitness_value>{fitness_value{}, 0, fitness_value{}, 0.0});
+        auto pending = std::make_shared<size_t>(self->state.islands.size());
+
+        if (!*pending) {
+          rp.deliver(*statistics);
+        }
+
+        for (const auto&[id, worker] : self->state.islands) {
+          self->request(worker, infinite, atom).then(
+              [=](fitness_statistics<fitness_value> &island_statistics) mutable {
+                if (id < statistics->size()) {
+                  (*statistics)[id] = island_statistics;
+                }
+
+                if (--*pending == 0) {
+                  rp.deliver(*statistics);
+                }
+              },
+              [=](error &err) mutable {
+                system_message(self, "Failed to collect statistics of island: ", id,
+                               " with error code: ", err.code());
+
+                if (--*pending == 0) {
+                  rp.deliver(*statistics);
+                }
+              }
+          );
+        }
+
+        return rp;
+      },
       [self](finish atom) {
         forward(self, atom);
       },
@@ -310,21 +914,52 @@ behavior island_model_dispatcher(
   };
 }
 
+/*
+ * EXECUTOR
+ *
+ * Drives the islands through generations and migrations. Unless global_termination_check is
+ * default_global_termination_check, islands report fitness statistics after every migration
+ * (or every termination_check_period generations without migration), the executor consults
+ * the termination check on their combination and finishes the islands early once it holds.
+ * With system_properties.is_adaptive_migration_active set, the statistics reported after every
+ * migration also drive the migration_controller choosing the period and quota of the next one.
+ */
+
+/*
+ * The number of generations to run before the next migration or termination check,
+ * 0 once generations_number generations have been run
+ */
+inline size_t next_period(size_t period, size_t generations_so_far, size_t generations_number) noexcept {
+  auto left = generations_so_far >= generations_number ? 0 : generations_number - generations_so_far;
+  return std::min(period, left);
+}
+
+template<typename individual, typename fitness_value, typename global_termination_check>
 struct island_model_executor_state : public base_state {
   island_model_executor_state() = default;
 
   explicit island_model_executor_state(const shared_config &config)
       : base_state{config},
-        generations_so_far{0} {
+        generations_so_far{0},
+        migration_quota{config->system_props.migration_quota},
+        termination_check{config, island_special},
+        migration_policy{config->system_props.migration_period, config->system_props.migration_quota} {
   }
 
   size_t generations_so_far;
+  size_t migration_quota;
+  global_termination_check termination_check;
+  migration_controller<fitness_value> migration_policy;
 };
 
+template<typename individual, typename fitness_value, typename global_termination_check>
 behavior island_model_executor(
-    stateful_actor<island_model_executor_state> *self,
-    island_model_executor_state state,
+    stateful_actor<island_model_executor_state<individual, fitness_value, global_termination_check>> *self,
+    island_model_executor_state<individual, fitness_value, global_termination_check> state,
     const actor &dispatcher) {
+  constexpr auto is_termination_checked = !std::is_same_v<global_termination_check,
+                                                          default_global_termination_check<individual, fitness_value>>;
+
   self->state = std::move(state);
   self->monitor(dispatcher);
 
@@ -339,47 +974,125 @@ behavior island_model_executor(
 
   const auto &props = self->state.config->system_props;
 
+  /*
+   * Adapt the period and quota of the next migration to the statistics of islands
+   */
+  auto adapt_migration = [self](const std::vector<fitness_statistics<fitness_value>> &islands) {
+    auto &state = self->state;
+
+    state.migration_policy.update(islands);
+    state.migration_quota = state.migration_policy.current_quota();
+
+    generation_message(self,
+                       report_migration_policy::value,
+                       now(),
+                       state.generations_so_far,
+                       state.migration_policy.current_period(),
+                       state.migration_quota);
+    system_message(self,
+                   "Migration period: ",
+                   state.migration_policy.current_period(),
+                   ", quota: ",
+                   state.migration_quota);
+
+    return state.migration_policy.current_period();
+  };
+
+  /*
+   * Go on with the given phase for another period while there are generations left and
+   * the termination check does not hold, finish the islands otherwise
+   */
+  auto advance = [self, dispatcher, adapt_migration](auto phase, size_t period, bool is_adaptive) {
+    auto next = [self, phase](bool should_stop, size_t period) {
+      auto &props = self->state.config->system_props;
+      auto generations = next_period(period, self->state.generations_so_far, props.generations_number);
+
+      if (should_stop || !generations) {
+        self->send(self, execute_phase_4::value);
+      } else {
+        self->send(self, phase, generations);
+      }
+    };
+
+    if (!is_termination_checked && !is_adaptive) {
+      next(false, period);
+      return;
+    }
+
+    self->request(dispatcher, infinite, collect_statistics::value).then(
+        [self, next, period, is_adaptive, adapt_migration](std::vector<fitness_statistics<fitness_value>> &islands) {
+          auto should_stop = false;
+
+          if constexpr (is_termination_checked) {
+            fitness_statistics<fitness_value> statistics{fitness_value{}, 0, fitness_value{}, 0.0};
+            for (const auto &island : islands) {
+              statistics.merge(island);
+            }
+
+            should_stop = self->state.termination_check(statistics);
+
+            if (should_stop) {
+              log(self, "Termination check holds after ", self->state.generations_so_far, " generations");
+            }
+          }
+
+          next(should_stop, is_adaptive ? adapt_migration(islands) : period);
+        },
+        [self, next, period](error &err) {
+          system_message(self, "Failed to collect fitness statistics with error code: ", err.code());
+          next(false, period);
+        }
+    );
+  };
+
   return {
       [=](execute_phase_1) {
         self->send(dispatcher, init_population::value);
 
-        if (props.is_migration_active) {
-          self->send(self, execute_phase_2::value, props.migration_period);
+        // Islands run on their own and the dispatcher quits once all of them are done
+        if (props.is_async_island_active) {
+          self->send(dispatcher, execute_evolution::value);
+        } else if (props.is_migration_active && props.generations_number) {
+          self->send(self, execute_phase_2::value, next_period(props.migration_period, 0, props.generations_number));
+        } else if (is_termination_checked) {
+          self->send(self,
+                     execute_phase_3::value,
+                     std::min(std::max(props.termination_check_period, size_t{1}), props.generations_number));
         } else {
           self->send(self, execute_phase_3::value);
         }
       },
       [=](execute_phase_2, size_t period) {
-        for (size_t i = 0; i < period; ++i) {
-          self->send(dispatcher, execute_generation::value);
-        }
+        self->send(dispatcher, execute_generation::value, period);
 
-        self->request(dispatcher, infinite, execute_migration::value).await(
-            [&](bool flag) {
+        self->request(dispatcher, infinite, execute_migration::value, self->state.migration_quota).await(
+            [=](bool flag) {
               if (!flag) return;
-              auto &props = self->state.config->system_props;
 
               self->state.generations_so_far += period;
 
               log(self, "Generations so far: ", self->state.generations_so_far);
 
-              if (self->state.generations_so_far < props.generations_number) {
-                self->send(self,
-                           execute_phase_2::value,
-                           std::min(props.migration_period, props.generations_number - self->state.generations_so_far));
-              } else {
-                self->send(self, execute_phase_4::value);
-              }
+              advance(execute_phase_2::value,
+                      std::min(props.migration_period, props.generations_number),
+                      props.is_adaptive_migration_active);
             }
         );
       },
       [=](execute_phase_3) {
-        for (size_t i = 0; i < props.generations_number; ++i) {
-          self->send(dispatcher, execute_generation::value);
-          log(self, "Generations so far: ", i + 1);
-        }
+        self->send(dispatcher, execute_generation::value, props.generations_number);
+        log(self, "Generations so far: ", props.generations_number);
         self->send(self, execute_phase_4::value);
       },
+      [=](execute_phase_3, size_t period) {
+        self->send(dispatcher, execute_generation::value, period);
+
+        self->state.generations_so_far += period;
+
+        log(self, "Generations so far: ", self->state.generations_so_far);
+
+        advance(execute_phase_3::value, std::max(props.termination_check_period, size_t{1}), false);
+      },
       [=](execute_phase_4) {
         self->send(dispatcher, finish::value);
       },
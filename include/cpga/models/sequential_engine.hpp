@@ -0,0 +1,197 @@
+#ifndef GENETIC_ACTOR_SEQUENTIAL_ENGINE_H
+#define GENETIC_ACTOR_SEQUENTIAL_ENGINE_H
+
+#include "../core.hpp"
+#include "../utilities/evaluation_bitmap.hpp"
+
+namespace cpga {
+using namespace core;
+namespace models {
+/**
+ * @brief The reporting policy of sequential_engine which reports nothing.
+ * @details A reporting policy is notified when the evolution starts and ends and when a generation starts and
+ * finishes. Calls to the empty member functions of this policy are compiled out, leaving the loop of
+ * sequential_engine free of any reporting.
+ * @tparam individual
+ * @tparam fitness_value
+ */
+template<typename individual, typename fitness_value>
+struct silent_reporting {
+  inline void evolution_started() const noexcept {
+  }
+
+  inline void generation_started() const noexcept {
+  }
+
+  inline void generation_finished(size_t generation) const noexcept {
+  }
+
+  inline void evolution_finished(size_t generations, const population<individual, fitness_value> &main) const
+  noexcept {
+  }
+};
+
+/**
+ * @brief Sequential genetic algorithm, run in the calling thread.
+ * @details The engine runs the same generational loop as the SEQUENTIAL model, without any actor taking part
+ * in it, so that it can be called as a plain library function, e.g. in micro-benchmarks or for problems too
+ * small to benefit from parallelism. Everything the loop reports goes through the reporting policy.
+ * @tparam individual
+ * @tparam fitness_value
+ * @tparam fitness_evaluation_operator
+ * @tparam initialization_operator
+ * @tparam crossover_operator
+ * @tparam mutation_operator
+ * @tparam parent_selection_operator
+ * @tparam survival_selection_operator
+ * @tparam elitism_operator
+ * @tparam global_termination_check
+ * @tparam reporting_policy the type providing evolution_started(), generation_started(),
+ * generation_finished(size_t generation) and evolution_finished(size_t generations, const population &main)
+ */
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator, typename initialization_operator,
+    typename crossover_operator, typename mutation_operator,
+    typename parent_selection_operator,
+    typename survival_selection_operator = default_survival_selection_operator<
+        individual, fitness_value>,
+    typename elitism_operator = default_elitism_operator<individual,
+                                                         fitness_value>,
+    typename global_termination_check = default_global_termination_check<
+        individual, fitness_value>,
+    typename reporting_policy = silent_reporting<individual, fitness_value>>
+class sequential_engine {
+ private:
+  shared_config config;
+  reporting_policy reporting;
+  size_t generations_so_far;
+
+  fitness_evaluation_operator fitness_evaluation;
+  initialization_operator initialization;
+  crossover_operator crossover;
+  mutation_operator mutation;
+  parent_selection_operator parent_selection;
+  survival_selection_operator survival_selection;
+  elitism_operator elitism;
+  global_termination_check termination_check;
+ public:
+  explicit sequential_engine(const shared_config &config, reporting_policy reporting = reporting_policy{})
+      : config{config},
+        reporting{std::move(reporting)},
+        generations_so_far{0},
+        fitness_evaluation{config, island_0},
+        initialization{config, island_0},
+        crossover{config, island_0},
+        mutation{config, island_0},
+        parent_selection{config, island_0},
+        survival_selection{config, island_0},
+        elitism{config, island_0},
+        termination_check{config, island_0} {
+  }
+
+  /**
+   * @brief Evolve a new population for system_properties.generations_number generations
+   * or until the global termination check holds.
+   * @return The final population, with current fitness values.
+   */
+  population<individual, fitness_value> run() {
+    auto &props = config->system_props;
+
+    couples<individual, fitness_value> parents;
+
+    population<individual, fitness_value> main;
+    population<individual, fitness_value> offspring;
+    population<individual, fitness_value> elitists;
+    evaluation_bitmap evaluated;
+
+    parents.reserve(props.population_size / 2);
+    main.reserve(props.population_size + props.elitists_number);
+    offspring.reserve(props.population_size);
+    elitists.reserve(props.elitists_number);
+
+    generations_so_far = 0;
+
+    reporting.evolution_started();
+
+    initialization(std::back_inserter(main));
+    evaluated.assign(main.size(), false);
+
+    while (generations_so_far < props.generations_number) {
+      reporting.generation_started();
+
+      if (!props.is_evaluation_tracking_active) {
+        evaluated.invalidate();
+      }
+
+      evaluated.evaluate(main, fitness_evaluation);
+
+      if (props.is_elitism_active) {
+        elitism(main, elitists);
+      }
+
+      // This will fill parents with individual_wrapper_pairs, each holding two copied individuals
+      parent_selection(main, parents);
+
+      // This will fill offspring with newly created individual_wrappers
+      auto offspring_inserter{std::back_inserter(offspring)};
+      for (const auto &couple : parents) {
+        crossover(offspring_inserter, couple);
+      }
+
+      // Clear parents for future use
+      parents.clear();
+
+      // This will apply mutation to each child in offspring
+      for (auto &child : offspring) {
+        mutation(child);
+      }
+
+      if (props.is_survival_selection_active) {
+        for (auto &child : offspring) {
+          child.second = fitness_evaluation(child.first);
+        }
+
+        survival_selection(main, offspring);
+      }
+
+      main.swap(offspring);
+      offspring.clear();
+      evaluated.assign(main.size(), props.is_survival_selection_active);
+
+      if (props.is_elitism_active) {
+        main.insert(main.end(),
+                    std::make_move_iterator(elitists.begin()),
+                    std::make_move_iterator(elitists.end()));
+        evaluated.append(elitists.size(), true);
+        elitists.clear();
+      }
+
+      reporting.generation_finished(generations_so_far++);
+
+      if (termination_check(main)) {
+        break;
+      }
+    }
+
+    if (!props.is_evaluation_tracking_active) {
+      evaluated.invalidate();
+    }
+
+    evaluated.evaluate(main, fitness_evaluation);
+
+    reporting.evolution_finished(generations_so_far, main);
+
+    return main;
+  }
+
+  /**
+   * @brief The number of generations the last run went through.
+   */
+  inline size_t generations() const noexcept {
+    return generations_so_far;
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_SEQUENTIAL_ENGINE_H
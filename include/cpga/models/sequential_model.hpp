@@ -2,135 +2,111 @@
 
 #include <caf/all.hpp>
 #include "../core.hpp"
+#include "sequential_engine.hpp"
 
 namespace cpga {
 using namespace core;
 namespace models {
-template<typename individual, typename fitness_value,
-    typename fitness_evaluation_operator, typename initialization_operator,
-    typename crossover_operator, typename mutation_operator,
-    typename parent_selection_operator,
-    typename survival_selection_operator = default_survival_selection_operator<
-        individual, fitness_value>,
-    typename elitism_operator = default_elitism_operator<individual,
-                                                         fitness_value>,
-    typename global_termination_check = default_global_termination_check<
-        individual, fitness_value>>
-class sequential_model_driver : public base_single_machine_driver<individual, fitness_value> {
+/**
+ * @brief The reporting policy of sequential_engine which sends notes to the reporter actors of configuration.
+ * @tparam individual
+ * @tparam fitness_value
+ */
+template<typename individual, typename fitness_value>
+class actor_reporting {
  private:
-  void run_pga(const scoped_actor &self, const shared_config &config) {
-    auto &props = config->system_props;
-
-    fitness_evaluation_operator fitness_evaluation{config, island_0};
-    initialization_operator initialization{config, island_0};
-    crossover_operator crossover{config, island_0};
-    mutation_operator mutation{config, island_0};
-    parent_selection_operator parent_selection{config, island_0};
-    survival_selection_operator survival_selection{config, island_0};
-    elitism_operator elitism{config, island_0};
-    global_termination_check termination_check{config, island_0};
-
-    couples<individual, fitness_value> parents;
-
-    population<individual, fitness_value> main;
-    population<individual, fitness_value> offspring;
-    population<individual, fitness_value> elitists;
-
-    parents.reserve(props.population_size / 2);
-    main.reserve(props.population_size + props.elitists_number);
-    offspring.reserve(props.population_size);
-    elitists.reserve(props.elitists_number);
+  const scoped_actor &self;
+  shared_config config;
+ public:
+  actor_reporting(const scoped_actor &self, const shared_config &config) : self{self}, config{config} {
+  }
 
-    if (props.is_generation_reporter_active) {
+  void evolution_started() const {
+    if (config->system_props.is_generation_reporter_active) {
       self->send(config->generation_reporter, note_start::value, now(), island_0);
     }
+  }
 
-    initialization(std::back_inserter(main));
-
-    for (size_t g = 0; g < props.generations_number; ++g) {
-      if (props.is_generation_reporter_active) {
-        self->send(config->generation_reporter, note_start::value, now(), island_0);
-      }
-
-      for (auto &member : main) {
-        member.second = fitness_evaluation(member.first);
-      }
-
-      if (props.is_elitism_active) {
-        elitism(main, elitists);
-      }
-
-      // This will fill parents with individual_wrapper_pairs, each holding two copied individuals
-      parent_selection(main, parents);
-
-      // This will fill offspring with newly created individual_wrappers
-      auto offspring_inserter{std::back_inserter(offspring)};
-      for (const auto &couple : parents) {
-        crossover(offspring_inserter, couple);
-      }
-
-      // Clear parents for future use
-      parents.clear();
-
-      // This will apply mutation to each child in offspring
-      for (auto &child : offspring) {
-        mutation(child);
-      }
-
-      if (props.is_survival_selection_active) {
-        for (auto &child : offspring) {
-          child.second = fitness_evaluation(child.first);
-        }
-
-        survival_selection(main, offspring);
-      }
-
-      main.swap(offspring);
-      offspring.clear();
-
-      if (props.is_elitism_active) {
-        main.insert(main.end(),
-                    std::make_move_iterator(elitists.begin()),
-                    std::make_move_iterator(elitists.end()));
-        elitists.clear();
-      }
-
-      if (props.is_generation_reporter_active) {
-        self->send(config->generation_reporter, note_end::value, now(), actor_phase::execute_generation, g, island_0);
-      }
-
-      log(self, "Generations so far: ", g);
-
-      if (termination_check(main)) {
-        break;
-      }
+  void generation_started() const {
+    if (config->system_props.is_generation_reporter_active) {
+      self->send(config->generation_reporter, note_start::value, now(), island_0);
     }
+  }
 
-    for (auto &member : main) {
-      member.second = fitness_evaluation(member.first);
+  void generation_finished(size_t generation) const {
+    if (config->system_props.is_generation_reporter_active) {
+      self->send(config->generation_reporter, note_end::value, now(),
+                 actor_phase::execute_generation, generation, island_0);
     }
 
-    if (props.is_generation_reporter_active) {
-      auto &generation_reporter = config->generation_reporter;
+    log(self, "Generations so far: ", generation + 1);
+  }
+
+  void evolution_finished(size_t generations, const population<individual, fitness_value> &main) const {
+    auto &props = config->system_props;
 
-      self->send(generation_reporter, note_end::value, now(),
-                 actor_phase::total, props.generations_number, island_0);
+    if (props.is_generation_reporter_active) {
+      self->send(config->generation_reporter, note_end::value, now(), actor_phase::total, generations, island_0);
     }
 
     if (props.is_individual_reporter_active) {
-      auto &individual_reporter = config->individual_reporter;
-
-      self->send(individual_reporter, report_population::value, main,
-                 props.generations_number, island_0);
+      self->send(config->individual_reporter, report_population::value, main, generations, island_0);
     }
   }
+};
 
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator, typename initialization_operator,
+    typename crossover_operator, typename mutation_operator,
+    typename parent_selection_operator,
+    typename survival_selection_operator = default_survival_selection_operator<
+        individual, fitness_value>,
+    typename elitism_operator = default_elitism_operator<individual,
+                                                         fitness_value>,
+    typename global_termination_check = default_global_termination_check<
+        individual, fitness_value>>
+class sequential_model_driver : public base_single_machine_driver<individual, fitness_value> {
  public:
   using base_single_machine_driver<individual, fitness_value>::base_single_machine_driver;
 
-  void perform(shared_config &config, actor_system &system, scoped_actor &self) override {
-    run_pga(self, config);
+  void perform(shared_config &config, scoped_actor &self) override {
+    sequential_engine<individual, fitness_value,
+                      fitness_evaluation_operator, initialization_operator,
+                      crossover_operator, mutation_operator,
+                      parent_selection_operator, survival_selection_operator,
+                      elitism_operator, global_termination_check,
+                      actor_reporting<individual, fitness_value>> engine{
+        config, actor_reporting<individual, fitness_value>{self, config}};
+
+    engine.run();
   }
 };
+
+/**
+ * @brief This alias facilitates running sequential model GA on a single machine.
+ * @see single_machine_runner
+ */
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator,
+    typename initialization_operator,
+    typename crossover_operator,
+    typename mutation_operator,
+    typename parent_selection_operator,
+    typename survival_selection_operator = default_survival_selection_operator<
+        individual, fitness_value>,
+    typename elitism_operator = default_elitism_operator<individual,
+                                                         fitness_value>,
+    typename global_termination_check = default_global_termination_check<
+        individual, fitness_value>>
+using sequential_single_machine_runner = single_machine_runner<sequential_model_driver<individual,
+                                                                                       fitness_value,
+                                                                                       fitness_evaluation_operator,
+                                                                                       initialization_operator,
+                                                                                       crossover_operator,
+                                                                                       mutation_operator,
+                                                                                       parent_selection_operator,
+                                                                                       survival_selection_operator,
+                                                                                       elitism_operator,
+                                                                                       global_termination_check>>;
+}
 }
-}
\ No newline at end of file
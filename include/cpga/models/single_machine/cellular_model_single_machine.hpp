@@ -0,0 +1,59 @@
+#ifndef GENETIC_ACTOR_CELLULAR_MODEL_DRIVER_H
+#define GENETIC_ACTOR_CELLULAR_MODEL_DRIVER_H
+
+#include "../../atoms.hpp"
+#include "../../core.hpp"
+#include "../cellular_model.hpp"
+
+namespace cpga {
+using namespace atoms;
+namespace models {
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator,
+    typename initialization_operator,
+    typename crossover_operator,
+    typename mutation_operator>
+class cellular_model_single_machine : public base_single_machine_driver<individual, fitness_value> {
+ public:
+  using base_single_machine_driver<individual, fitness_value>::base_single_machine_driver;
+
+  void perform(shared_config &config, scoped_actor &self) override {
+    std::vector<actor> workers(config->system_props.islands_number);
+    auto spawn_worker = [&] {
+      auto worker = self->template spawn<monitored + detached>(cellular_model_worker<individual,
+                                                                                     fitness_value,
+                                                                                     fitness_evaluation_operator,
+                                                                                     crossover_operator,
+                                                                                     mutation_operator>,
+                                                               config);
+      system_message(self, config->system_reporter, "Spawning worker (actor id: ", worker.id(), ")");
+      return worker;
+    };
+    std::generate(std::begin(workers), std::end(workers), spawn_worker);
+
+    auto executor = self->spawn<detached + monitored>(
+        cellular_model_executor<individual, fitness_value, initialization_operator>,
+        cellular_model_executor_state<individual, fitness_value, initialization_operator>{config, workers});
+
+    self->send(executor, init_population::value);
+    self->wait_for(executor);
+  }
+};
+
+/**
+ * @brief This alias facilitates running cellular model PGA on a single machine.
+ * @see single_machine_runner
+ */
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator, typename initialization_operator,
+    typename crossover_operator, typename mutation_operator>
+using cellular_single_machine_runner = single_machine_runner<cellular_model_single_machine<individual,
+                                                                                           fitness_value,
+                                                                                           fitness_evaluation_operator,
+                                                                                           initialization_operator,
+                                                                                           crossover_operator,
+                                                                                           mutation_operator>>;
+}
+}
+
+#endif //GENETIC_ACTOR_CELLULAR_MODEL_DRIVER_H
@@ -41,11 +41,20 @@ class global_model_single_machine : public base_single_machine_driver<individual
         global_model_supervisor<individual, fitness_value>,
         global_model_supervisor_state{config, workers});
 
+    auto executor_behavior = config->system_props.is_steady_state_active
+                             ? global_model_steady_state_executor<individual, fitness_value,
+                                                                  initialization_operator, crossover_operator,
+                                                                  mutation_operator, parent_selection_operator,
+                                                                  global_termination_check,
+                                                                  survival_selection_operator, elitism_operator>
+                             : global_model_executor<individual, fitness_value,
+                                                     initialization_operator, crossover_operator,
+                                                     mutation_operator, parent_selection_operator,
+                                                     global_termination_check,
+                                                     survival_selection_operator, elitism_operator>;
+
     auto executor = self->spawn<detached + monitored>(
-        global_model_executor<individual, fitness_value,
-                              initialization_operator, crossover_operator, mutation_operator,
-                              parent_selection_operator, global_termination_check,
-                              survival_selection_operator, elitism_operator>,
+        executor_behavior,
         global_model_executor_state<individual, fitness_value,
                                     initialization_operator, crossover_operator, mutation_operator,
                                     parent_selection_operator, global_termination_check,
@@ -45,11 +45,11 @@ class grid_model_single_machine : public base_single_machine_driver<individual,
         grid_model_dispatcher<individual, fitness_value>,
         grid_model_dispatcher_state{config, workers});
 
-    auto executor = self->spawn<detached + monitored>(
-        grid_model_executor<individual, fitness_value, initialization_operator,
-                            fitness_evaluation_operator>,
-        config,
-        dispatcher);
+    auto executor_behavior = config->system_props.is_grid_partition_persistent
+                             ? grid_model_persistent_executor<individual, fitness_value, initialization_operator>
+                             : grid_model_executor<individual, fitness_value, initialization_operator>;
+
+    auto executor = self->spawn<detached + monitored>(executor_behavior, config, dispatcher);
 
     self->send(executor, init_population::value);
     self->wait_for(executor);
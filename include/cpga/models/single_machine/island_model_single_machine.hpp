@@ -20,12 +20,19 @@ template<typename individual, typename fitness_value,
     typename parent_selection_operator,
     typename survival_selection_operator,
     typename elitism_operator,
-    typename migration_operator>
+    typename migration_operator,
+    typename global_termination_check>
 class island_model_single_machine : public base_single_machine_driver<individual, fitness_value> {
  public:
   using base_single_machine_driver<individual, fitness_value>::base_single_machine_driver;
 
   void perform(shared_config &config, scoped_actor &self) override {
+    actor evaluators;
+    if (config->system_props.island_evaluators_number) {
+      evaluators = spawn_island_evaluators<individual, fitness_value, fitness_evaluation_operator>(self, config);
+      system_message(self, config->system_reporter, "Spawning island evaluators (actor id: ", evaluators.id(), ")");
+    }
+
     std::vector<actor> workers(config->system_props.islands_number);
     auto spawn_worker = [&] {
       auto island = self->template spawn<monitored + detached>(island_model_worker<individual, fitness_value,
@@ -36,18 +43,25 @@ class island_model_single_machine : public base_single_machine_driver<individual
                                                                                    parent_selection_operator,
                                                                                    survival_selection_operator,
                                                                                    elitism_operator,
-                                                                                   migration_operator>, config);
+                                                                                   migration_operator>,
+                                                                       config,
+                                                                       evaluators);
       system_message(self, config->system_reporter, "Spawning island (actor id: ", island.id(), ")");
       return island;
     };
     std::generate(std::begin(workers), std::end(workers), spawn_worker);
 
+    if (evaluators) {
+      self->spawn<detached>(island_evaluators_guard, evaluators, workers);
+    }
+
     auto dispatcher = self->spawn<detached>(island_model_dispatcher<individual, fitness_value>,
                                             island_model_dispatcher_state{config, workers});
 
-    auto executor = self->spawn<detached + monitored>(island_model_executor,
-                                                      island_model_executor_state{config},
-                                                      dispatcher);
+    auto executor = self->spawn<detached + monitored>(
+        island_model_executor<individual, fitness_value, global_termination_check>,
+        island_model_executor_state<individual, fitness_value, global_termination_check>{config},
+        dispatcher);
 
     self->send(executor, execute_phase_1::value);
     self->wait_for(executor);
@@ -67,7 +81,9 @@ template<typename individual, typename fitness_value,
     typename elitism_operator = default_elitism_operator<individual,
                                                          fitness_value>,
     typename migration_operator = default_migration_operator<individual,
-                                                             fitness_value>>
+                                                             fitness_value>,
+    typename global_termination_check = default_global_termination_check<individual,
+                                                                         fitness_value>>
 using island_single_machine_runner = single_machine_runner<island_model_single_machine<individual,
                                                                                        fitness_value,
                                                                                        fitness_evaluation_operator,
@@ -77,7 +93,8 @@ using island_single_machine_runner = single_machine_runner<island_model_single_m
                                                                                        parent_selection_operator,
                                                                                        survival_selection_operator,
                                                                                        elitism_operator,
-                                                                                       migration_operator>>;
+                                                                                       migration_operator,
+                                                                                       global_termination_check>>;
 }
 }
 
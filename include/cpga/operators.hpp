@@ -8,6 +8,9 @@
 #include "core.hpp"
 #include "operators/average_fitness_global_termination_check.hpp"
 #include "operators/best_individual_elitism.hpp"
+#include "operators/cached_fitness_evaluation.hpp"
+#include "operators/linear_ranking_parent_selection.hpp"
+#include "operators/linear_ranking_survival_selection.hpp"
 #include "operators/ring_best_migration.hpp"
 #include "operators/ring_random_migration.hpp"
 #include "operators/roulette_wheel_parent_selection.hpp"
@@ -15,5 +18,8 @@
 #include "operators/sequence_individual_crossover.hpp"
 #include "operators/sequence_individual_initialization.hpp"
 #include "operators/star_random_migration.hpp"
+#include "operators/stochastic_universal_sampling_parent_selection.hpp"
+#include "operators/tournament_parent_selection.hpp"
+#include "operators/tournament_survival_selection.hpp"
 
 #endif //GENETIC_ACTOR_OPERATORS_H
@@ -21,6 +21,15 @@ class average_fitness_global_termination_check : public base_operator {
   size_t stable_so_far;
   size_t stable_required;
   fitness_value minimum_average;
+
+  bool is_stable(const fitness_value &average) noexcept {
+    if (average >= minimum_average) {
+      return ++stable_so_far == stable_required;
+    }
+
+    stable_so_far = 0;
+    return false;
+  }
  public:
   average_fitness_global_termination_check() = default;
   average_fitness_global_termination_check(const shared_config &config,
@@ -48,12 +57,20 @@ class average_fitness_global_termination_check : public base_operator {
                                           fitness_value{},
                                           [](auto acc, const auto &m) { return acc + m.second; }) / population.size();
 
-    if (total >= minimum_average) {
-      return ++stable_so_far == stable_required;
+    return is_stable(total);
+  }
+
+  /**
+   * @brief perform actual check on statistics of populations held elsewhere, e.g. by islands.
+   * @param statistics the combined fitness statistics
+   * @return Whether the stopping condition has been reached.
+   */
+  bool operator()(const fitness_statistics<fitness_value> &statistics) noexcept {
+    if (!statistics.count) {
+      return true;
     }
 
-    stable_so_far = 0;
-    return false;
+    return is_stable(statistics.sum / static_cast<fitness_value>(statistics.count));
   }
 };
 }
@@ -12,8 +12,8 @@ using namespace utilities;
 namespace operators {
 /**
  * @brief Genetic operator selecting and saving eletists from a common population.
- * @details This class performs elitism by first sorting the population by fitness
- * value in descending order, then moving first n individuals to the elitits population
+ * @details This class performs elitism by first moving the n fittest individuals to the front
+ * of the population in descending order of fitness value, then moving them to the elitits population
  * and erasing them from the common one.
  * @tparam individual
  * @tparam fitness_value
@@ -30,9 +30,11 @@ class best_individual_elitism : public base_operator {
    */
   void operator()(population<individual, fitness_value> &main,
                   population<individual, fitness_value> &elitists) const {
-    population_sorter<individual, fitness_value>::sort(main);
+    auto elitists_number = std::min(main.size(), config->system_props.elitists_number);
 
-    auto end = std::next(main.begin(), std::min(main.size(), config->system_props.elitists_number));
+    population_sorter<individual, fitness_value>::top(main, elitists_number);
+
+    auto end = std::next(main.begin(), elitists_number);
 
     elitists.insert(
         elitists.end(),
@@ -16,9 +16,9 @@ using namespace utilities;
 namespace operators {
 /**
  * @brief Genetic operator producing a migration payload for a given island.
- * @details This class performs migration by first sorting the population by fitness value
- * in descending order, then moving at most system_properties.migration_quota individuals into the payload (and erasing them
- * from population). User must implement the pure virtual method next_destination which specifies
+ * @details This class performs migration by first moving the fittest individuals to the front of the population
+ * in descending order of fitness value, then moving at most system_properties.migration_quota of them into
+ * the payload (and erasing them from population). User must implement the pure virtual method next_destination which specifies
  * the destination island for the n'th migrant.
  * @tparam individual
  * @tparam fitness_value
@@ -44,14 +44,24 @@ class best_migration : public base_operator {
    * @param pop the source island population
    * @return The migration payload.
    */
-  auto operator()(__attribute__((unused)) island_id from, population<individual, fitness_value> &pop) {
-    auto &props = config->system_props;
+  auto operator()(island_id from, population<individual, fitness_value> &pop) {
+    return (*this)(from, pop, config->system_props.migration_quota);
+  }
 
+  /**
+   * @brief Builds the migration payload for a given island, overriding system_properties.migration_quota.
+   * @param from the source island id
+   * @param pop the source island population
+   * @param quota the maximum number of migrants
+   * @return The migration payload.
+   */
+  auto operator()(__attribute__((unused)) island_id from, population<individual, fitness_value> &pop, size_t quota) {
     migration_payload<individual, fitness_value> payload;
-    population_sorter<individual, fitness_value>::sort(pop);
+    auto migrants_number = std::min(quota, pop.size());
+
+    population_sorter<individual, fitness_value>::top(pop, migrants_number);
 
-    auto quota{std::min(props.migration_quota, pop.size())};
-    auto end{std::next(pop.begin(), quota)};
+    auto end{std::next(pop.begin(), migrants_number)};
     for (auto it{pop.begin()}; it != end; ++it) {
       payload.emplace_back(next_destination(*it), std::move(*it));
     }
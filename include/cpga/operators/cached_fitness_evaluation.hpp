@@ -0,0 +1,80 @@
+#ifndef GENETIC_ACTOR_CACHED_FITNESS_EVALUATION_H
+#define GENETIC_ACTOR_CACHED_FITNESS_EVALUATION_H
+
+#include <memory>
+#include "../core.hpp"
+#include "../utilities/fitness_cache.hpp"
+
+namespace cpga {
+using namespace core;
+using namespace utilities;
+namespace operators {
+/**
+ * @brief Genetic operator memoizing the results of another fitness evaluation operator.
+ * @details This class consults a fitness_cache before delegating to the wrapped operator, so that
+ * individuals evaluated before (elitists, clones produced by crossover, unmutated children or returning migrants)
+ * are not evaluated again. The cache is kept in the configuration of the run and shared by every instance with
+ * the same template arguments using it, i.e. by all global model workers and islands running on a machine, and
+ * holds at most system_properties.fitness_cache_capacity entries. The wrapped operator has to be deterministic.
+ * @tparam individual
+ * @tparam fitness_value
+ * @tparam fitness_evaluation_operator the wrapped fitness evaluation operator
+ * @tparam hasher the hash function identifying individuals
+ * @tparam equal the equality of individuals with the same hash
+ */
+template<typename individual, typename fitness_value,
+    typename fitness_evaluation_operator,
+    typename hasher = individual_hash<individual>,
+    typename equal = individual_equal<individual>>
+class cached_fitness_evaluation : public base_operator {
+ private:
+  fitness_evaluation_operator fitness_evaluation;
+  hasher hash;
+  std::shared_ptr<fitness_cache<individual, fitness_value, equal>> cache;
+  size_t hits;
+  size_t misses;
+ public:
+  cached_fitness_evaluation() = default;
+  cached_fitness_evaluation(const shared_config &config, island_id island_no)
+      : base_operator{config, island_no},
+        fitness_evaluation{config, island_no},
+        cache{config->operator_states.get<cached_fitness_evaluation, fitness_cache<individual, fitness_value, equal>>(
+            config->system_props.fitness_cache_capacity)},
+        hits{0},
+        misses{0} {
+  }
+
+  /**
+   * @brief Return the cached fitness value of an individual or compute (and cache) it.
+   * @param ind the individual
+   * @return Resulting fitness value
+   */
+  fitness_value operator()(const individual &ind) {
+    auto key = hash(ind);
+
+    fitness_value value;
+    if (cache->find(key, ind, value)) {
+      ++hits;
+      return value;
+    }
+
+    ++misses;
+    value = fitness_evaluation(ind);
+    cache->insert(key, ind, value);
+
+    return value;
+  }
+
+  /**
+   * @brief Summary of the cache usage by this operator, reported through the system reporter.
+   * @return The human readable hit/miss counters.
+   */
+  std::string statistics() const {
+    return str("Fitness cache (island ", island_no, "): ", hits, " hits, ", misses, " misses, ",
+               cache->size(), " entries cached");
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_CACHED_FITNESS_EVALUATION_H
@@ -0,0 +1,100 @@
+#ifndef GENETIC_ACTOR_LINEAR_RANKING_PARENT_SELECTION_H
+#define GENETIC_ACTOR_LINEAR_RANKING_PARENT_SELECTION_H
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include "../core.hpp"
+
+namespace cpga {
+using namespace core;
+namespace operators {
+/**
+ * @brief Genetic operator performing parent selection for crossover using linear ranking method.
+ * @details Members are ranked from the worst (rank 0) to the best (rank n - 1) once per call and each parent
+ * is drawn with probability ((2 - s) + 2 * (s - 1) * rank / (n - 1)) / n, where s is the selection pressure read
+ * from the user property strings::SELECTION_PRESSURE (a double in range [1, 2], 1.5 if not given). A draw takes
+ * O(1) time: with probability 2 - s the rank is uniform, otherwise it is the greater of two distinct uniform
+ * ranks, which is distributed proportionally to the rank. As fitness values are only compared, they can be
+ * negative, and minimization is expressed by passing std::greater as compare.
+ * @tparam individual
+ * @tparam fitness_value
+ * @tparam compare the ordering of fitness values, compare(a, b) holds when a is worse than b
+ */
+template<typename individual, typename fitness_value, typename compare = std::less<fitness_value>>
+class linear_ranking_parent_selection : public base_operator {
+ private:
+  std::default_random_engine generator;
+  std::uniform_real_distribution<double> distribution;
+  std::function<double()> random_one;
+  double pressure;
+  compare is_worse;
+
+  inline size_t random_index(size_t size) const noexcept {
+    return std::min(static_cast<size_t>(random_one() * size), size - 1);
+  }
+
+  inline size_t draw_rank(size_t size) const {
+    auto rank = random_index(size);
+
+    if (random_one() < 2.0 - pressure) {
+      return rank;
+    }
+
+    auto other = random_index(size - 1);
+
+    if (other >= rank) {
+      ++other;
+    }
+
+    return std::max(rank, other);
+  }
+ public:
+  linear_ranking_parent_selection() = default;
+  linear_ranking_parent_selection(const shared_config &config,
+                                  island_id island_no)
+      : base_operator{config, island_no},
+        generator{get_seed(config->system_props.parent_selection_seed)},
+        distribution{0.0, 1.0},
+        random_one{std::bind(distribution, generator)},
+        pressure{config->user_props.count(strings::SELECTION_PRESSURE)
+                 ? std::clamp(std::any_cast<double>(config->user_props.at(strings::SELECTION_PRESSURE)), 1.0, 2.0)
+                 : 1.5} {
+  }
+
+  /**
+   * @brief Fills couples with selected individidual pairs.
+   * @param population the common population
+   * @param couples the collection of resulting couples (a vector of wrapper pairs)
+   */
+  void operator()(population<individual, fitness_value> &population,
+                  couples<individual, fitness_value> &couples) const {
+    auto couples_num = population.size() / 2;
+
+    if (!couples_num) {
+      return;
+    }
+
+    std::vector<size_t> ranking(population.size());
+    std::iota(std::begin(ranking), std::end(ranking), size_t{});
+    std::sort(std::begin(ranking), std::end(ranking), [&](size_t a, size_t b) {
+      return is_worse(population[a].second, population[b].second);
+    });
+
+    for (size_t i = 0; i < couples_num; ++i) {
+      auto first = ranking[draw_rank(ranking.size())];
+      auto second = ranking[draw_rank(ranking.size())];
+
+      if (second == first) {
+        second = (second + 1) % population.size();
+      }
+
+      couples.emplace_back(population[first], population[second]);
+    }
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_LINEAR_RANKING_PARENT_SELECTION_H
@@ -0,0 +1,111 @@
+#ifndef GENETIC_ACTOR_LINEAR_RANKING_SURVIVAL_SELECTION_H
+#define GENETIC_ACTOR_LINEAR_RANKING_SURVIVAL_SELECTION_H
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include "../core.hpp"
+#include "../utilities/fenwick_tree.hpp"
+
+namespace cpga {
+using namespace core;
+using namespace utilities;
+namespace operators {
+/**
+ * @brief Genetic operator performing survival selection using linear ranking method.
+ * @details Parents and offspring are joined into a single pool, ranked from the worst (rank 0) to the best
+ * (rank n - 1). As many survivors as there were parents are drawn without replacement, each with probability
+ * proportional to (2 - s) * (n - 1) + 2 * (s - 1) * rank among the members not drawn yet, where s is the selection
+ * pressure read from the user property strings::SELECTION_PRESSURE (a double in range [1, 2], 1.5 if not given).
+ * Weights are kept in a fenwick_tree, so that a draw takes O(log n) time.
+ * @tparam individual
+ * @tparam fitness_value
+ * @tparam compare the ordering of fitness values, compare(a, b) holds when a is worse than b
+ */
+template<typename individual, typename fitness_value, typename compare = std::less<fitness_value>>
+class linear_ranking_survival_selection : public base_operator {
+ private:
+  std::default_random_engine generator;
+  std::uniform_real_distribution<double> distribution;
+  std::function<double()> random_one;
+  double pressure;
+  compare is_worse;
+ public:
+  /**
+   * @brief The weight of a rank among size ranked members under a given selection pressure.
+   */
+  static inline double rank_weight(size_t rank, size_t size, double pressure) noexcept {
+    return (2.0 - pressure) * (size - 1) + 2.0 * (pressure - 1.0) * rank;
+  }
+
+  linear_ranking_survival_selection() = default;
+  linear_ranking_survival_selection(const shared_config &config,
+                                    island_id island_no)
+      : base_operator{config, island_no},
+        generator{get_seed(config->system_props.survival_selection_seed)},
+        distribution{0.0, 1.0},
+        random_one{std::bind(distribution, generator)},
+        pressure{config->user_props.count(strings::SELECTION_PRESSURE)
+                 ? std::clamp(std::any_cast<double>(config->user_props.at(strings::SELECTION_PRESSURE)), 1.0, 2.0)
+                 : 1.5} {
+  }
+
+  /**
+   * @brief Fills offspring with the survivors of parents and offspring.
+   * @param parents the current population, emptied by the selection
+   * @param offspring the newly created members, replaced by the survivors
+   */
+  void operator()(population<individual, fitness_value> &parents,
+                  population<individual, fitness_value> &offspring) const {
+    auto survivors_num = parents.size();
+
+    parents.reserve(parents.size() + offspring.size());
+    parents.insert(parents.end(),
+                   std::make_move_iterator(offspring.begin()),
+                   std::make_move_iterator(offspring.end()));
+    offspring.clear();
+    offspring.reserve(survivors_num);
+
+    std::vector<size_t> ranking(parents.size());
+    std::iota(std::begin(ranking), std::end(ranking), size_t{});
+    std::sort(std::begin(ranking), std::end(ranking), [&](size_t a, size_t b) {
+      return is_worse(parents[a].second, parents[b].second);
+    });
+
+    std::vector<double> rank_weights(ranking.size());
+    for (size_t rank = 0; rank < rank_weights.size(); ++rank) {
+      rank_weights[rank] = rank_weight(rank, rank_weights.size(), pressure);
+    }
+
+    fenwick_tree<double> weights{rank_weights};
+    std::vector<bool> drawn(ranking.size(), false);
+    size_t best_left = ranking.size();
+
+    for (size_t i = 0; i < survivors_num; ++i) {
+      size_t rank = ranking.size();
+
+      if (weights.total() > 0) {
+        rank = weights.find(random_one() * weights.total());
+      }
+
+      // Once the point is lost to rounding error or no weight is left, the best member left survives
+      if (rank >= ranking.size() || drawn[rank]) {
+        while (drawn[--best_left]) {
+        }
+
+        rank = best_left;
+      }
+
+      drawn[rank] = true;
+      weights.add(rank, -rank_weights[rank]);
+      offspring.emplace_back(std::move(parents[ranking[rank]]));
+    }
+
+    parents.clear();
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_LINEAR_RANKING_SURVIVAL_SELECTION_H
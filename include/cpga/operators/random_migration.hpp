@@ -11,8 +11,9 @@ namespace operators {
 /**
  * @brief Genetic operator producing a migration payload for a given island.
  * @details This class performs migration by randomly moving at most system_properties.migration_quota
- * individuals into the payload (and erasing them from population). User must implement the pure virtual
- * method next_destination which specifies the destination island for the n'th migrant.
+ * individuals into the payload (and erasing them from population) in O(quota) time, as each migrant is replaced
+ * by the last member of the population. User must implement the pure virtual method next_destination which
+ * specifies the destination island for the n'th migrant.
  * @tparam individual
  * @tparam fitness_value
  */
@@ -42,18 +43,36 @@ class random_migration : public base_operator {
  * @param pop the source island population
  * @return The migration payload.
  */
-  auto operator()(__attribute__((unused)) island_id from, population<individual, fitness_value> &population) {
+  auto operator()(island_id from, population<individual, fitness_value> &population) {
+    return (*this)(from, population, config->system_props.migration_quota);
+  }
+
+  /**
+   * @brief Builds the migration payload for a given island, overriding system_properties.migration_quota.
+   * @param from the source island id
+   * @param pop the source island population
+   * @param quota the maximum number of migrants
+   * @return The migration payload.
+   */
+  auto operator()(__attribute__((unused)) island_id from,
+                  population<individual, fitness_value> &population,
+                  size_t quota) {
     migration_payload<individual, fitness_value> payload;
-    auto quota = std::min(population.size(), config->system_props.migration_quota);
+    quota = std::min(population.size(), quota);
 
+    payload.reserve(quota);
+
+    // The last member takes the place of each migrant, so that no member is shifted
     for (size_t i = 0; i < quota; ++i) {
-      auto next = std::next(
-          population.begin(),
-          std::uniform_int_distribution<size_t>{0, population.size() - 1}(generator)
-      );
+      auto next = std::uniform_int_distribution<size_t>{0, population.size() - 1}(generator);
+
+      payload.emplace_back(next_destination(population[next]), std::move(population[next]));
+
+      if (next + 1 != population.size()) {
+        population[next] = std::move(population.back());
+      }
 
-      payload.emplace_back(next_destination(*next), std::move(*next));
-      population.erase(next);
+      population.pop_back();
     }
 
     return payload;
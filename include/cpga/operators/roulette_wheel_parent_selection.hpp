@@ -1,6 +1,8 @@
 #ifndef GENETIC_ACTOR_ROULETTE_WHEEL_PARENT_SELECTION_H
 #define GENETIC_ACTOR_ROULETTE_WHEEL_PARENT_SELECTION_H
 
+#include <algorithm>
+#include <numeric>
 #include <random>
 #include "../core.hpp"
 
@@ -11,6 +13,7 @@ namespace operators {
  * @brief Genetic operator performing parent selection for crossover using roulette-wheel method.
  * @details This class perform parent selection bt applying the
  * <a href="https://en.wikipedia.org/wiki/Fitness_proportionate_selection">fitness proportionate selection</a>.
+ * Cumulative fitness values are computed once per call, each spin takes O(log n) time.
  * @tparam individual
  * @tparam fitness_value
  */
@@ -21,18 +24,27 @@ class roulette_wheel_parent_selection : public base_operator {
   std::uniform_real_distribution<double> distribution;
   std::function<double()> random_one;
 
-  inline size_t spin(
-      const fitness_value &total_fitness,
-      const population<individual, fitness_value> &population) const
-  noexcept {
-    auto rand_fitness{random_one() * total_fitness};
-    size_t start{0};
-    while (rand_fitness > 0) {
-      rand_fitness -= population[start++].second;
-    }
-    return start - 1;
+  inline size_t spin(const std::vector<fitness_value> &cumulative) const noexcept {
+    return find(cumulative, random_one() * cumulative.back());
   }
  public:
+  /**
+   * @brief Find the member of the wheel a point of the total fitness value falls into.
+   * @details This is the first member whose cumulative fitness value is not less than the point, i.e. the member
+   * a linear scan subtracting fitness values from the point stops at. Members with a zero fitness value are never
+   * chosen, not even for point 0.
+   * @param cumulative the cumulative fitness values of the population
+   * @param point the point in range [0, cumulative.back())
+   * @return The index of the member.
+   */
+  template<typename point_type>
+  static size_t find(const std::vector<fitness_value> &cumulative, point_type point) noexcept {
+    // Skip leading members with zero fitness values, which the point could only hit when it is 0
+    auto first = std::upper_bound(std::begin(cumulative), std::end(cumulative), fitness_value{});
+    auto it = std::lower_bound(first, std::end(cumulative), point);
+    return std::min(static_cast<size_t>(std::distance(std::begin(cumulative), it)), cumulative.size() - 1);
+  }
+
   roulette_wheel_parent_selection() = default;
   roulette_wheel_parent_selection(const shared_config &config,
                                   island_id island_no)
@@ -51,14 +63,21 @@ class roulette_wheel_parent_selection : public base_operator {
                   couples<individual, fitness_value> &couples) const {
     auto couples_num = population.size() / 2;
 
-    auto total = std::accumulate(std::begin(population),
-                                 std::end(population),
-                                 fitness_value{},
-                                 [](auto acc, const auto &m) { return acc + m.second; });
+    if (!couples_num) {
+      return;
+    }
+
+    // Computed once, so that every spin is a binary search instead of a scan of the population
+    std::vector<fitness_value> cumulative(population.size());
+    std::transform_inclusive_scan(std::begin(population),
+                                  std::end(population),
+                                  std::begin(cumulative),
+                                  std::plus<>{},
+                                  [](const auto &m) { return m.second; });
 
     for (size_t i = 0; i < couples_num; ++i) {
-      auto first = spin(total, population);
-      auto second = spin(total, population);
+      auto first = spin(cumulative);
+      auto second = spin(cumulative);
 
       if (second == first) {
         second = (second + 1) % population.size();
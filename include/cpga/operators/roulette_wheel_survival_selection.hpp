@@ -1,12 +1,25 @@
 #ifndef GENETIC_ACTOR_ROULETTE_WHEEL_SURVIVAL_SELECTION_H
 #define GENETIC_ACTOR_ROULETTE_WHEEL_SURVIVAL_SELECTION_H
 
+#include <algorithm>
 #include <random>
 #include "../core.hpp"
+#include "../utilities/fenwick_tree.hpp"
 
 namespace cpga {
 using namespace core;
+using namespace utilities;
 namespace operators {
+/**
+ * @brief Genetic operator performing survival selection using roulette-wheel method.
+ * @details Parents and offspring are joined into a single pool, from which as many survivors as there were
+ * parents are drawn without replacement, each with probability proportional to its fitness value among
+ * the members not drawn yet. Fitness values are kept in a fenwick_tree, so that each draw and the removal
+ * of the drawn member take O(log n) time. Once only members of zero fitness value remain, they survive
+ * in pool order.
+ * @tparam individual
+ * @tparam fitness_value
+ */
 template<typename individual, typename fitness_value>
 class roulette_wheel_survival_selection : public base_operator {
  private:
@@ -14,14 +27,21 @@ class roulette_wheel_survival_selection : public base_operator {
   std::uniform_real_distribution<double> distribution;
   std::function<double()> random_one;
 
-  inline size_t spin(const fitness_value &total_fitness,
-                     const population<individual, fitness_value> &population) const noexcept {
-    auto rand_fitness{random_one() * total_fitness};
-    size_t start{0};
-    while (rand_fitness > 0) {
-      rand_fitness -= population[start++].second;
+  /*
+   * Draw a member not drawn yet, falling back to the first one left when the drawn point
+   * is lost to rounding error or no member of non-zero fitness value is left
+   */
+  inline size_t spin(const fenwick_tree<double> &weights, const std::vector<bool> &drawn, size_t &first_left) const {
+    while (drawn[first_left]) {
+      ++first_left;
     }
-    return start - 1;
+
+    if (weights.total() <= 0) {
+      return first_left;
+    }
+
+    auto survivor = weights.find(random_one() * weights.total());
+    return survivor < drawn.size() && !drawn[survivor] ? survivor : first_left;
   }
  public:
   roulette_wheel_survival_selection() = default;
@@ -34,6 +54,11 @@ class roulette_wheel_survival_selection : public base_operator {
 
   }
 
+  /**
+   * @brief Fills offspring with the survivors of parents and offspring.
+   * @param parents the current population, emptied by the selection
+   * @param offspring the newly created members, replaced by the survivors
+   */
   void operator()(population<individual, fitness_value> &parents,
                   population<individual, fitness_value> &offspring) const {
     auto survivors_num = parents.size();
@@ -43,18 +68,27 @@ class roulette_wheel_survival_selection : public base_operator {
                    std::make_move_iterator(offspring.begin()),
                    std::make_move_iterator(offspring.end()));
     offspring.clear();
+    offspring.reserve(survivors_num);
 
-    auto total = std::accumulate(std::begin(parents),
-                                 std::end(parents),
-                                 fitness_value{},
-                                 [](auto acc, const auto &m) { return acc + m.second; });
+    std::vector<double> fitness_values(parents.size());
+    std::transform(std::begin(parents),
+                   std::end(parents),
+                   std::begin(fitness_values),
+                   [](const auto &m) { return static_cast<double>(m.second); });
+
+    fenwick_tree<double> weights{fitness_values};
+    std::vector<bool> drawn(parents.size(), false);
+    size_t first_left = 0;
 
     for (size_t i = 0; i < survivors_num; ++i) {
-      auto survivor = spin(total, parents);
+      auto survivor = spin(weights, drawn, first_left);
 
+      drawn[survivor] = true;
+      weights.add(survivor, -fitness_values[survivor]);
       offspring.emplace_back(std::move(parents[survivor]));
-      offspring.erase(offspring.begin() + survivor);
     }
+
+    parents.clear();
   }
 };
 }
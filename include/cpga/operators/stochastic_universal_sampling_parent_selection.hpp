@@ -0,0 +1,120 @@
+#ifndef GENETIC_ACTOR_STOCHASTIC_UNIVERSAL_SAMPLING_PARENT_SELECTION_H
+#define GENETIC_ACTOR_STOCHASTIC_UNIVERSAL_SAMPLING_PARENT_SELECTION_H
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include "../core.hpp"
+
+namespace cpga {
+using namespace core;
+namespace operators {
+/**
+ * @brief Genetic operator performing parent selection for crossover using stochastic universal sampling.
+ * @details This class performs
+ * <a href="https://en.wikipedia.org/wiki/Stochastic_universal_sampling">stochastic universal sampling</a>:
+ * every parent is chosen at once by a single spin of a wheel with equally spaced pointers. Members are chosen
+ * with the same expected frequency as with roulette_wheel_parent_selection, but the number of times a member
+ * is chosen never differs from the expected one by more than one. Chosen parents are shuffled before being
+ * paired up, a couple of the same member is paired with the next member instead, as in roulette-wheel selection.
+ * The whole selection takes O(n) time.
+ * @tparam individual
+ * @tparam fitness_value
+ */
+template<typename individual, typename fitness_value>
+class stochastic_universal_sampling_parent_selection : public base_operator {
+ private:
+  std::default_random_engine generator;
+  std::uniform_real_distribution<double> distribution;
+  std::function<double()> random_one;
+ public:
+  /**
+   * @brief Choose count members by a single spin of a wheel with count equally spaced pointers.
+   * @details Every member is chosen either the floor or the ceiling of count times its share of the total fitness
+   * value times. When the total fitness value is zero, every member is given the same share.
+   * @param population the population
+   * @param count the number of members to choose
+   * @param offset the position of the first pointer as a fraction of the spacing of pointers, in range [0, 1)
+   * @return The indices of chosen members, in ascending order.
+   */
+  static std::vector<size_t> sample(const population<individual, fitness_value> &population,
+                                    size_t count,
+                                    double offset) {
+    std::vector<size_t> chosen;
+
+    if (population.empty() || !count) {
+      return chosen;
+    }
+
+    auto total = std::accumulate(std::begin(population),
+                                 std::end(population),
+                                 fitness_value{},
+                                 [](auto acc, const auto &m) { return acc + m.second; });
+    auto is_uniform = !(fitness_value{} < total);
+    auto weight = [is_uniform](const auto &m) { return is_uniform ? 1.0 : static_cast<double>(m.second); };
+
+    auto spacing = (is_uniform ? static_cast<double>(population.size()) : static_cast<double>(total)) / count;
+    auto pointer = offset * spacing;
+
+    chosen.reserve(count);
+
+    // Pointers grow monotonically, so a single pass over the cumulative fitness values finds every member
+    auto cumulative = weight(population.front());
+    for (size_t member = 0; chosen.size() < count; pointer += spacing) {
+      while (cumulative <= pointer && member + 1 < population.size()) {
+        cumulative += weight(population[++member]);
+      }
+
+      chosen.push_back(member);
+    }
+
+    return chosen;
+  }
+
+  stochastic_universal_sampling_parent_selection() = default;
+  stochastic_universal_sampling_parent_selection(const shared_config &config,
+                                                 island_id island_no)
+      : base_operator{config, island_no},
+        generator{get_seed(config->system_props.parent_selection_seed)},
+        distribution{0.0, 1.0},
+        random_one{std::bind(distribution, generator)} {
+  }
+
+  /**
+   * @brief Fills couples with selected individidual pairs.
+   * @param population the common population
+   * @param couples the collection of resulting couples (a vector of wrapper pairs)
+   */
+  void operator()(population<individual, fitness_value> &population,
+                  couples<individual, fitness_value> &couples) const {
+    auto couples_num = population.size() / 2;
+
+    if (!couples_num) {
+      return;
+    }
+
+    auto parents_num = 2 * couples_num;
+    auto parents = sample(population, parents_num, random_one());
+
+    // Fisher-Yates shuffle drawing from random_one, so that the operator stays const like the other ones
+    for (auto i = parents_num - 1; i > 0; --i) {
+      auto j = std::min(static_cast<size_t>(random_one() * (i + 1)), i);
+      std::swap(parents[i], parents[j]);
+    }
+
+    for (size_t i = 0; i < parents_num; i += 2) {
+      auto first = parents[i];
+      auto second = parents[i + 1];
+
+      if (second == first) {
+        second = (second + 1) % population.size();
+      }
+
+      couples.emplace_back(population[first], population[second]);
+    }
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_STOCHASTIC_UNIVERSAL_SAMPLING_PARENT_SELECTION_H
@@ -0,0 +1,84 @@
+#ifndef GENETIC_ACTOR_TOURNAMENT_PARENT_SELECTION_H
+#define GENETIC_ACTOR_TOURNAMENT_PARENT_SELECTION_H
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include "../core.hpp"
+
+namespace cpga {
+using namespace core;
+namespace operators {
+/**
+ * @brief Genetic operator performing parent selection for crossover using k-tournament method.
+ * @details Each parent is the best of k members drawn uniformly with replacement, where k is read from
+ * the user property strings::TOURNAMENT_SIZE (a size_t, 2 if not given). Only indices are drawn and compared,
+ * so a draw takes O(k) time and members are copied into couples only once chosen. As fitness values are only
+ * compared, they can be negative, and minimization is expressed by passing std::greater as compare.
+ * @tparam individual
+ * @tparam fitness_value
+ * @tparam compare the ordering of fitness values, compare(a, b) holds when a is worse than b
+ */
+template<typename individual, typename fitness_value, typename compare = std::less<fitness_value>>
+class tournament_parent_selection : public base_operator {
+ private:
+  std::default_random_engine generator;
+  std::uniform_real_distribution<double> distribution;
+  std::function<double()> random_one;
+  size_t tournament_size;
+  compare is_worse;
+
+  inline size_t random_index(size_t size) const noexcept {
+    return std::min(static_cast<size_t>(random_one() * size), size - 1);
+  }
+
+  inline size_t tournament(const population<individual, fitness_value> &population) const {
+    auto winner = random_index(population.size());
+    for (size_t i = 1; i < tournament_size; ++i) {
+      auto contender = random_index(population.size());
+
+      if (is_worse(population[winner].second, population[contender].second)) {
+        winner = contender;
+      }
+    }
+
+    return winner;
+  }
+ public:
+  tournament_parent_selection() = default;
+  tournament_parent_selection(const shared_config &config,
+                              island_id island_no)
+      : base_operator{config, island_no},
+        generator{get_seed(config->system_props.parent_selection_seed)},
+        distribution{0.0, 1.0},
+        random_one{std::bind(distribution, generator)},
+        tournament_size{config->user_props.count(strings::TOURNAMENT_SIZE)
+                        ? std::max(std::any_cast<size_t>(config->user_props.at(strings::TOURNAMENT_SIZE)), size_t{1})
+                        : 2} {
+  }
+
+  /**
+   * @brief Fills couples with selected individidual pairs.
+   * @param population the common population
+   * @param couples the collection of resulting couples (a vector of wrapper pairs)
+   */
+  void operator()(population<individual, fitness_value> &population,
+                  couples<individual, fitness_value> &couples) const {
+    auto couples_num = population.size() / 2;
+
+    for (size_t i = 0; i < couples_num; ++i) {
+      auto first = tournament(population);
+      auto second = tournament(population);
+
+      if (second == first) {
+        second = (second + 1) % population.size();
+      }
+
+      couples.emplace_back(population[first], population[second]);
+    }
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_TOURNAMENT_PARENT_SELECTION_H
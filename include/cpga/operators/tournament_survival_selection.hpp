@@ -0,0 +1,89 @@
+#ifndef GENETIC_ACTOR_TOURNAMENT_SURVIVAL_SELECTION_H
+#define GENETIC_ACTOR_TOURNAMENT_SURVIVAL_SELECTION_H
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include "../core.hpp"
+
+namespace cpga {
+using namespace core;
+namespace operators {
+/**
+ * @brief Genetic operator performing survival selection using k-tournament method.
+ * @details Parents and offspring are joined into a single pool, from which as many survivors as there were
+ * parents are chosen without replacement, each as the best of k members drawn uniformly from those not chosen
+ * yet. k is read from the user property strings::TOURNAMENT_SIZE (a size_t, 2 if not given). Indices of members
+ * left are kept in a vector, the winner being swapped with the last one, so a draw takes O(k) time.
+ * @tparam individual
+ * @tparam fitness_value
+ * @tparam compare the ordering of fitness values, compare(a, b) holds when a is worse than b
+ */
+template<typename individual, typename fitness_value, typename compare = std::less<fitness_value>>
+class tournament_survival_selection : public base_operator {
+ private:
+  std::default_random_engine generator;
+  std::uniform_real_distribution<double> distribution;
+  std::function<double()> random_one;
+  size_t tournament_size;
+  compare is_worse;
+
+  inline size_t random_index(size_t size) const noexcept {
+    return std::min(static_cast<size_t>(random_one() * size), size - 1);
+  }
+ public:
+  tournament_survival_selection() = default;
+  tournament_survival_selection(const shared_config &config,
+                                island_id island_no)
+      : base_operator{config, island_no},
+        generator{get_seed(config->system_props.survival_selection_seed)},
+        distribution{0.0, 1.0},
+        random_one{std::bind(distribution, generator)},
+        tournament_size{config->user_props.count(strings::TOURNAMENT_SIZE)
+                        ? std::max(std::any_cast<size_t>(config->user_props.at(strings::TOURNAMENT_SIZE)), size_t{1})
+                        : 2} {
+  }
+
+  /**
+   * @brief Fills offspring with the survivors of parents and offspring.
+   * @param parents the current population, emptied by the selection
+   * @param offspring the newly created members, replaced by the survivors
+   */
+  void operator()(population<individual, fitness_value> &parents,
+                  population<individual, fitness_value> &offspring) const {
+    auto survivors_num = parents.size();
+
+    parents.reserve(parents.size() + offspring.size());
+    parents.insert(parents.end(),
+                   std::make_move_iterator(offspring.begin()),
+                   std::make_move_iterator(offspring.end()));
+    offspring.clear();
+    offspring.reserve(survivors_num);
+
+    std::vector<size_t> left(parents.size());
+    std::iota(std::begin(left), std::end(left), size_t{});
+
+    for (size_t i = 0; i < survivors_num; ++i) {
+      auto winner = random_index(left.size());
+      for (size_t j = 1; j < tournament_size; ++j) {
+        auto contender = random_index(left.size());
+
+        if (is_worse(parents[left[winner]].second, parents[left[contender]].second)) {
+          winner = contender;
+        }
+      }
+
+      offspring.emplace_back(std::move(parents[left[winner]]));
+
+      std::swap(left[winner], left.back());
+      left.pop_back();
+    }
+
+    parents.clear();
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_TOURNAMENT_SURVIVAL_SELECTION_H
@@ -0,0 +1,99 @@
+#ifndef GENETIC_ACTOR_EVALUATION_BITMAP_H
+#define GENETIC_ACTOR_EVALUATION_BITMAP_H
+
+#include <vector>
+#include "../common.hpp"
+
+namespace cpga {
+namespace utilities {
+/**
+ * @brief Records which members of a population hold a current fitness value.
+ * @details The bitmap is kept parallel to a population by the model owning it: members produced by
+ * crossover and mutation are appended as not evaluated, while elitists, survivors of survival selection and
+ * migrants keep their fitness value. Models use it to skip fitness evaluation of members whose fitness is
+ * still valid, which assumes the fitness evaluation operator is deterministic.
+ */
+class evaluation_bitmap {
+ private:
+  std::vector<bool> evaluated;
+ public:
+  /**
+   * @brief Mark size members as either evaluated or not, discarding previous state.
+   */
+  inline void assign(size_t size, bool value) {
+    evaluated.assign(size, value);
+  }
+
+  /**
+   * @brief Mark count members appended to the population as either evaluated or not.
+   */
+  inline void append(size_t count, bool value) {
+    evaluated.insert(evaluated.end(), count, value);
+  }
+
+  /**
+   * @brief Mark the members at the given indices as evaluated, growing the bitmap if needed.
+   */
+  inline void mark(const std::vector<size_t> &indices) {
+    for (auto i : indices) {
+      if (i >= evaluated.size()) {
+        evaluated.resize(i + 1, false);
+      }
+      evaluated[i] = true;
+    }
+  }
+
+  /**
+   * @brief Mark every member of the population as not evaluated.
+   */
+  inline void invalidate() {
+    evaluated.assign(evaluated.size(), false);
+  }
+
+  inline bool is_evaluated(size_t i) const {
+    return i < evaluated.size() && evaluated[i];
+  }
+
+  inline size_t size() const noexcept {
+    return evaluated.size();
+  }
+
+  /**
+   * @brief Indices of members of a population of a given size which need to be evaluated.
+   */
+  std::vector<size_t> pending(size_t size) const {
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < size; ++i) {
+      if (!is_evaluated(i)) {
+        indices.push_back(i);
+      }
+    }
+    return indices;
+  }
+
+  /**
+   * @brief Evaluate members of a population which are not evaluated yet and mark the whole population as evaluated.
+   * @param pop the population this bitmap runs parallel to
+   * @param fitness_evaluation the fitness evaluation operator
+   * @return The number of fitness evaluations performed.
+   */
+  template<typename individual, typename fitness_value, typename fitness_evaluation_operator>
+  size_t evaluate(population<individual, fitness_value> &pop, fitness_evaluation_operator &fitness_evaluation) {
+    size_t evaluations{0};
+
+    for (size_t i = 0; i < pop.size(); ++i) {
+      if (!is_evaluated(i)) {
+        pop[i].second = fitness_evaluation(pop[i].first);
+        ++evaluations;
+      }
+    }
+
+    assign(pop.size(), true);
+
+    return evaluations;
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_EVALUATION_BITMAP_H
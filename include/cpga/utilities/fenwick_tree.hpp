@@ -0,0 +1,82 @@
+#ifndef GENETIC_ACTOR_FENWICK_TREE_H
+#define GENETIC_ACTOR_FENWICK_TREE_H
+
+#include <vector>
+
+namespace cpga {
+namespace utilities {
+/**
+ * @brief Binary indexed tree over non-negative weights.
+ * @details Supports changing a weight and finding the element a point of the cumulative weight falls into
+ * in O(log n) time, which makes it suitable for weighted sampling without replacement: an element is drawn
+ * by finding a random point of the total weight and removed by setting its weight to zero.
+ * @tparam weight
+ */
+template<typename weight>
+class fenwick_tree {
+ private:
+  std::vector<weight> tree;
+  weight sum{};
+  size_t mask{1};
+ public:
+  fenwick_tree() = default;
+
+  /**
+   * @brief Build the tree over the given weights in O(n) time.
+   */
+  explicit fenwick_tree(const std::vector<weight> &weights) : tree(weights.size() + 1) {
+    for (size_t i = 1; i < tree.size(); ++i) {
+      tree[i] += weights[i - 1];
+      sum += weights[i - 1];
+
+      auto parent = i + (i & (~i + 1));
+      if (parent < tree.size()) {
+        tree[parent] += tree[i];
+      }
+    }
+
+    while (mask <= weights.size() / 2) {
+      mask <<= 1;
+    }
+  }
+
+  /**
+   * @brief Add delta to the weight of the element at index.
+   */
+  inline void add(size_t index, weight delta) {
+    sum += delta;
+    for (auto i = index + 1; i < tree.size(); i += i & (~i + 1)) {
+      tree[i] += delta;
+    }
+  }
+
+  /**
+   * @brief Find the first element whose cumulative weight exceeds point.
+   * @return The index of the element, or the number of elements if point is not less than the total weight.
+   */
+  inline size_t find(weight point) const {
+    size_t index = 0;
+
+    for (auto step = mask; step; step >>= 1) {
+      auto next = index + step;
+      if (next < tree.size() && !(point < tree[next])) {
+        index = next;
+        point -= tree[next];
+      }
+    }
+
+    return index;
+  }
+
+  inline weight total() const noexcept {
+    return sum;
+  }
+
+  inline size_t size() const noexcept {
+    return tree.empty() ? 0 : tree.size() - 1;
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_FENWICK_TREE_H
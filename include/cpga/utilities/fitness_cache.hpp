@@ -0,0 +1,192 @@
+#ifndef GENETIC_ACTOR_FITNESS_CACHE_H
+#define GENETIC_ACTOR_FITNESS_CACHE_H
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <type_traits>
+
+namespace cpga {
+namespace utilities {
+/**
+ * @brief Default hash function used to identify individuals in the fitness_cache.
+ * @details Individuals with a std::hash specialisation are hashed with it, sequences
+ * (anything with std::begin and std::end) are hashed element by element and trivially
+ * copyable individuals (e.g. plain structs of numbers) are hashed by their object representation.
+ * @tparam individual
+ */
+template<typename individual>
+struct individual_hash {
+ private:
+  template<typename T, typename = void>
+  struct is_std_hashable : std::false_type {};
+
+  template<typename T>
+  struct is_std_hashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T &>()))>> : std::true_type {};
+
+  template<typename T, typename = void>
+  struct is_sequence : std::false_type {};
+
+  template<typename T>
+  struct is_sequence<T, std::void_t<decltype(std::begin(std::declval<const T &>())),
+                                    decltype(std::end(std::declval<const T &>()))>> : std::true_type {};
+
+  static inline void combine(size_t &seed, size_t hash) noexcept {
+    seed ^= hash + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+  }
+
+  template<typename T>
+  static size_t hash(const T &value) noexcept {
+    if constexpr (is_std_hashable<T>::value) {
+      return std::hash<T>{}(value);
+    } else if constexpr (is_sequence<T>::value) {
+      size_t seed{0};
+      for (const auto &element : value) {
+        combine(seed, hash(element));
+      }
+      return seed;
+    } else {
+      static_assert(std::is_trivially_copyable<T>::value,
+                    "individual_hash requires a std::hash specialisation, a sequence or a trivially copyable type");
+      unsigned char bytes[sizeof(T)];
+      std::memcpy(bytes, &value, sizeof(T));
+      return std::hash<std::string_view>{}(std::string_view{reinterpret_cast<const char *>(bytes), sizeof(T)});
+    }
+  }
+ public:
+  size_t operator()(const individual &ind) const noexcept {
+    return hash(ind);
+  }
+};
+
+/**
+ * @brief Default equality of individuals used by the fitness_cache to tell apart individuals with equal hashes.
+ * @details Individuals with operator== are compared with it, sequences are compared element by element and
+ * trivially copyable individuals are compared by their object representation, as in individual_hash.
+ * @tparam individual
+ */
+template<typename individual>
+struct individual_equal {
+ private:
+  template<typename T, typename = void>
+  struct is_equality_comparable : std::false_type {};
+
+  template<typename T>
+  struct is_equality_comparable<T, std::void_t<decltype(std::declval<const T &>() == std::declval<const T &>())>>
+      : std::true_type {};
+
+  template<typename T, typename = void>
+  struct is_sequence : std::false_type {};
+
+  template<typename T>
+  struct is_sequence<T, std::void_t<decltype(std::begin(std::declval<const T &>())),
+                                    decltype(std::end(std::declval<const T &>()))>> : std::true_type {};
+
+  template<typename T>
+  static bool equal(const T &a, const T &b) noexcept {
+    if constexpr (is_equality_comparable<T>::value) {
+      return a == b;
+    } else if constexpr (is_sequence<T>::value) {
+      return std::equal(std::begin(a), std::end(a), std::begin(b), std::end(b),
+                        [](const auto &x, const auto &y) { return equal(x, y); });
+    } else {
+      static_assert(std::is_trivially_copyable<T>::value,
+                    "individual_equal requires operator==, a sequence or a trivially copyable type");
+      return !std::memcmp(&a, &b, sizeof(T));
+    }
+  }
+ public:
+  bool operator()(const individual &a, const individual &b) const noexcept {
+    return equal(a, b);
+  }
+};
+
+/**
+ * @brief A thread safe, bounded map from individuals to fitness values.
+ * @details The cache evicts the least recently used entry once it holds capacity entries. Entries are found
+ * by the hash of an individual, and a copy of the individual is kept with every entry, so that an individual
+ * whose hash collides with the hash of a cached one is never given its fitness value. An entry is replaced by
+ * a colliding individual when it is inserted.
+ * @tparam individual
+ * @tparam fitness_value
+ * @tparam equal the equality of individuals
+ */
+template<typename individual, typename fitness_value, typename equal = individual_equal<individual>>
+class fitness_cache {
+ private:
+  struct entry {
+    size_t hash;
+    individual ind;
+    fitness_value value;
+  };
+
+  size_t capacity;
+  equal is_equal;
+  std::list<entry> entries;
+  std::unordered_map<size_t, typename std::list<entry>::iterator> index;
+  mutable std::mutex mutex;
+ public:
+  explicit fitness_cache(size_t capacity) : capacity{capacity} {
+    index.reserve(capacity);
+  }
+
+  /**
+   * @brief Look up the fitness value stored for an individual.
+   * @param hash the hash of the individual
+   * @param ind the individual
+   * @param value the fitness value, assigned to only on a hit
+   * @return Whether the individual was found in the cache.
+   */
+  bool find(size_t hash, const individual &ind, fitness_value &value) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (auto it{index.find(hash)}; it != index.end() && is_equal(it->second->ind, ind)) {
+      entries.splice(entries.begin(), entries, it->second);
+      value = it->second->value;
+      return true;
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Store the fitness value of an individual, evicting the least recently used entry if the cache is full.
+   * @param hash the hash of the individual
+   * @param ind the individual
+   * @param value the fitness value of the individual
+   */
+  void insert(size_t hash, const individual &ind, const fitness_value &value) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (!capacity) {
+      return;
+    }
+
+    if (auto it{index.find(hash)}; it != index.end()) {
+      it->second->ind = ind;
+      it->second->value = value;
+      entries.splice(entries.begin(), entries, it->second);
+      return;
+    }
+
+    if (entries.size() == capacity) {
+      index.erase(entries.back().hash);
+      entries.pop_back();
+    }
+
+    entries.push_front(entry{hash, ind, value});
+    index.emplace(hash, entries.begin());
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return entries.size();
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_FITNESS_CACHE_H
@@ -0,0 +1,66 @@
+#ifndef GENETIC_ACTOR_LATENCY_TRACKER_H
+#define GENETIC_ACTOR_LATENCY_TRACKER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace cpga {
+namespace utilities {
+/**
+ * @brief Keeps a sliding window of the most recent request latencies.
+ * @details Used by dispatchers to tell a straggling request from a regular one: once enough latencies have been
+ * recorded, a request taking longer than a given percentile of the window is considered to straggle.
+ */
+class latency_tracker {
+ private:
+  std::vector<std::chrono::nanoseconds> samples;
+  size_t window;
+  size_t next;
+ public:
+  explicit latency_tracker(size_t window = 256) : window{std::max(window, size_t{1})}, next{0} {
+    samples.reserve(this->window);
+  }
+
+  /**
+   * @brief Record the latency of a completed request, replacing the oldest one once the window is full.
+   */
+  void record(std::chrono::nanoseconds latency) {
+    if (samples.size() < window) {
+      samples.push_back(latency);
+    } else {
+      samples[next] = latency;
+      next = (next + 1) % window;
+    }
+  }
+
+  inline size_t size() const noexcept {
+    return samples.size();
+  }
+
+  /**
+   * @brief The nearest-rank percentile of the recorded latencies.
+   * @param p the percentile as a fraction in range [0, 1]
+   * @param min_samples the number of latencies below which no estimate is given
+   * @return The latency, or nothing if too few latencies were recorded so far.
+   */
+  std::optional<std::chrono::nanoseconds> percentile(double p, size_t min_samples = 16) const {
+    if (samples.empty() || samples.size() < min_samples) {
+      return std::nullopt;
+    }
+
+    auto rank = static_cast<size_t>(std::ceil(std::clamp(p, 0.0, 1.0) * samples.size()));
+    auto k = std::min(rank ? rank - 1 : 0, samples.size() - 1);
+
+    auto sorted = samples;
+    std::nth_element(std::begin(sorted), std::next(std::begin(sorted), k), std::end(sorted));
+
+    return sorted[k];
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_LATENCY_TRACKER_H
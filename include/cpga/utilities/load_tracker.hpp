@@ -0,0 +1,124 @@
+#ifndef GENETIC_ACTOR_LOAD_TRACKER_H
+#define GENETIC_ACTOR_LOAD_TRACKER_H
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+namespace cpga {
+namespace utilities {
+/**
+ * @brief Keeps track of the individuals outstanding at a pool of workers and of how fast each worker gets
+ * through them.
+ * @details Used by load aware dispatch: a batch goes to the worker expected to be done with it first, given
+ * the individuals it has outstanding and its throughput, so slower workers are given less work. A worker
+ * handles its batches one after another, so the time a batch took is measured from the completion of the
+ * previous one, or from its assignment if the worker was idle. Workers yet to complete a batch are assumed
+ * to be as fast as the average measured worker.
+ */
+class load_tracker {
+ private:
+  using clock = std::chrono::high_resolution_clock;
+
+  struct worker_load {
+    size_t outstanding;
+    double throughput;
+    clock::time_point busy_since;
+  };
+
+  std::vector<worker_load> workers;
+  double smoothing;
+
+  inline double expected_throughput(const worker_load &worker, double average) const noexcept {
+    return worker.throughput > 0 ? worker.throughput : average;
+  }
+ public:
+  /**
+   * @param workers the number of workers
+   * @param smoothing the weight of the latest measurement in the throughput of a worker, in range (0, 1]
+   */
+  explicit load_tracker(size_t workers = 0, double smoothing = 0.5)
+      : workers(workers, worker_load{0, 0.0, clock::time_point{}}), smoothing{smoothing} {
+  }
+
+  /**
+   * @brief The worker expected to be done with a batch of load individuals first, there has to be at least one.
+   */
+  size_t pick(size_t load) const {
+    double sum{0.0};
+    size_t measured{0};
+    for (const auto &worker : workers) {
+      if (worker.throughput > 0) {
+        sum += worker.throughput;
+        ++measured;
+      }
+    }
+
+    auto average = measured ? sum / measured : 1.0;
+    auto done = [this, load, average](size_t i) {
+      return (workers[i].outstanding + load) / expected_throughput(workers[i], average);
+    };
+
+    size_t best{0};
+    for (size_t i = 1; i < workers.size(); ++i) {
+      if (done(i) < done(best)) {
+        best = i;
+      }
+    }
+
+    return best;
+  }
+
+  inline void assign(size_t worker, size_t load, clock::time_point at) {
+    auto &w = workers[worker];
+
+    if (!w.outstanding) {
+      w.busy_since = at;
+    }
+    w.outstanding += load;
+  }
+
+  /**
+   * @brief Account for a batch the worker completed, updating its throughput.
+   */
+  void complete(size_t worker, size_t load, clock::time_point at) {
+    auto &w = workers[worker];
+    auto seconds = std::chrono::duration<double>(at - w.busy_since).count();
+
+    if (load && seconds > 0) {
+      auto throughput = load / seconds;
+      w.throughput = w.throughput > 0 ? smoothing * throughput + (1 - smoothing) * w.throughput : throughput;
+    }
+
+    release(worker, load);
+    w.busy_since = at;
+  }
+
+  /**
+   * @brief Account for a batch the worker failed, leaving its throughput as it is.
+   */
+  inline void release(size_t worker, size_t load) {
+    auto &value = workers[worker].outstanding;
+    value -= std::min(value, load);
+  }
+
+  inline void remove(size_t worker) {
+    workers.erase(std::next(std::begin(workers), worker));
+  }
+
+  inline size_t outstanding(size_t worker) const {
+    return workers[worker].outstanding;
+  }
+
+  inline double throughput(size_t worker) const {
+    return workers[worker].throughput;
+  }
+
+  inline size_t size() const noexcept {
+    return workers.size();
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_LOAD_TRACKER_H
@@ -0,0 +1,105 @@
+#ifndef GENETIC_ACTOR_MIGRATION_CONTROLLER_H
+#define GENETIC_ACTOR_MIGRATION_CONTROLLER_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "../common.hpp"
+
+namespace cpga {
+namespace utilities {
+/**
+ * @brief Adapts the migration period and quota of the ISLAND model between migrations.
+ * @details After every migration the controller is given fitness statistics of each island. An island improved
+ * if its best fitness value grew since the previous migration, its diversity is the coefficient of variation of
+ * its fitness values. While at least half of the islands improve, migration is made rarer and smaller, leaving
+ * islands to explore on their own. Once most islands stagnate, migration is made more frequent and larger if
+ * islands are still diverse, so that good individuals spread, and rarer otherwise, as mixing islands which
+ * have already converged only collapses their diversity further. The period stays in range [1, 4 * initial period]
+ * and the quota in range [1, 4 * initial quota].
+ * @tparam fitness_value
+ */
+template<typename fitness_value>
+class migration_controller {
+ private:
+  size_t period;
+  size_t quota;
+  size_t max_period;
+  size_t max_quota;
+  double diversity_threshold;
+  std::vector<fitness_value> previous_best;
+ public:
+  migration_controller() = default;
+  migration_controller(size_t period, size_t quota, double diversity_threshold = 0.05)
+      : period{std::max(period, size_t{1})},
+        quota{quota},
+        max_period{4 * this->period},
+        max_quota{4 * quota},
+        diversity_threshold{diversity_threshold} {
+  }
+
+  /**
+   * @brief Adapt the period and quota to the current state of islands.
+   * @param islands fitness statistics of each island, in the same order every time
+   */
+  void update(const std::vector<fitness_statistics<fitness_value>> &islands) {
+    if (islands.size() != previous_best.size()) {
+      previous_best.clear();
+      std::transform(std::begin(islands),
+                     std::end(islands),
+                     std::back_inserter(previous_best),
+                     [](const auto &statistics) { return statistics.best; });
+      return;
+    }
+
+    size_t measured = 0;
+    size_t improved = 0;
+    double diversity = 0;
+
+    for (size_t i = 0; i < islands.size(); ++i) {
+      const auto &statistics = islands[i];
+
+      if (!statistics.count) {
+        continue;
+      }
+
+      if (previous_best[i] < statistics.best) {
+        ++improved;
+      }
+
+      auto count = static_cast<double>(statistics.count);
+      auto mean = static_cast<double>(statistics.sum) / count;
+      auto deviation = std::sqrt(std::max(statistics.sum_of_squares / count - mean * mean, 0.0));
+
+      diversity += mean != 0 ? deviation / std::abs(mean) : deviation;
+      ++measured;
+      previous_best[i] = statistics.best;
+    }
+
+    if (!measured) {
+      return;
+    }
+
+    if (2 * improved >= measured) {
+      period = std::min(2 * period, max_period);
+      quota = quota ? std::max(quota - 1, size_t{1}) : 0;
+    } else if (diversity / measured >= diversity_threshold) {
+      period = std::max(period / 2, size_t{1});
+      quota = std::min(quota + 1, max_quota);
+    } else {
+      period = std::min(2 * period, max_period);
+    }
+  }
+
+  inline size_t current_period() const noexcept {
+    return period;
+  }
+
+  inline size_t current_quota() const noexcept {
+    return quota;
+  }
+};
+}
+}
+
+#endif //GENETIC_ACTOR_MIGRATION_CONTROLLER_H
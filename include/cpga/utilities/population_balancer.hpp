@@ -0,0 +1,94 @@
+#ifndef GENETIC_ACTOR_POPULATION_BALANCER_H
+#define GENETIC_ACTOR_POPULATION_BALANCER_H
+
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <vector>
+#include "../common.hpp"
+
+namespace cpga {
+namespace utilities {
+/**
+ * @brief A number of individuals to be moved from one island to another.
+ */
+struct population_transfer {
+  island_id from;
+  island_id to;
+  size_t count;
+};
+
+/**
+ * @brief Plan transfers of individuals between islands, so that the time islands take per generation evens out.
+ * @details The throughput of an island is its population size divided by the time it spent on generations.
+ * Each island is assigned a share of the total population proportional to its throughput, which would
+ * let all islands finish a generation at the same time. Only the damping fraction of the difference between
+ * the current and the assigned size is closed at once, so that noisy measurements do not make populations
+ * swing back and forth.
+ * @param sizes the population sizes of islands, indexed by island_id
+ * @param times the time each island spent on generations since the previous plan, indexed by island_id
+ * @param minimum_size the size below which a population is never shrunk
+ * @param damping the fraction of the difference closed at once, in range (0, 1]
+ * @return The transfers, empty if any island has no measurement yet.
+ */
+inline std::vector<population_transfer> plan_population_transfers(const std::vector<size_t> &sizes,
+                                                                  const std::vector<std::chrono::nanoseconds> &times,
+                                                                  size_t minimum_size,
+                                                                  double damping = 0.5) {
+  auto islands = sizes.size();
+
+  if (islands < 2 || times.size() != islands) {
+    return {};
+  }
+
+  std::vector<double> throughputs(islands);
+  for (size_t i = 0; i < islands; ++i) {
+    if (!sizes[i] || times[i].count() <= 0) {
+      return {};
+    }
+
+    throughputs[i] = static_cast<double>(sizes[i]) / times[i].count();
+  }
+
+  auto total = static_cast<double>(std::accumulate(std::begin(sizes), std::end(sizes), size_t{}));
+  auto total_throughput = std::accumulate(std::begin(throughputs), std::end(throughputs), 0.0);
+
+  std::vector<std::pair<island_id, size_t>> surpluses;
+  std::vector<std::pair<island_id, size_t>> deficits;
+
+  for (size_t i = 0; i < islands; ++i) {
+    auto share = total * throughputs[i] / total_throughput;
+    auto target = static_cast<double>(sizes[i]) + damping * (share - static_cast<double>(sizes[i]));
+    auto size = std::max(static_cast<size_t>(std::llround(std::max(target, 0.0))), std::min(sizes[i], minimum_size));
+
+    if (size < sizes[i]) {
+      surpluses.emplace_back(i, sizes[i] - size);
+    } else if (size > sizes[i]) {
+      deficits.emplace_back(i, size - sizes[i]);
+    }
+  }
+
+  std::vector<population_transfer> transfers;
+  auto surplus = std::begin(surpluses);
+  auto deficit = std::begin(deficits);
+
+  while (surplus != std::end(surpluses) && deficit != std::end(deficits)) {
+    auto count = std::min(surplus->second, deficit->second);
+
+    transfers.push_back({surplus->first, deficit->first, count});
+
+    if (!(surplus->second -= count)) {
+      ++surplus;
+    }
+
+    if (!(deficit->second -= count)) {
+      ++deficit;
+    }
+  }
+
+  return transfers;
+}
+}
+}
+
+#endif //GENETIC_ACTOR_POPULATION_BALANCER_H
@@ -5,6 +5,8 @@
 #ifndef GENETIC_ACTOR_INDIVIDUAL_COMPARATOR_H
 #define GENETIC_ACTOR_INDIVIDUAL_COMPARATOR_H
 
+#include <algorithm>
+
 namespace cpga {
 namespace utilities {
 template<typename individual, typename fitness_value>
@@ -17,6 +19,21 @@ class population_sorter {
   inline static void sort(population<individual, fitness_value> &pop) {
     std::sort(std::begin(pop), std::end(pop), compFunctor);
   }
+
+  /*
+   * Move the k fittest members to the front of the population in descending order, leaving the rest
+   * in no particular order, in O(n + k log k) time
+   */
+  inline static void top(population<individual, fitness_value> &pop, size_t k) {
+    if (k >= pop.size()) {
+      sort(pop);
+      return;
+    }
+
+    auto end = std::next(std::begin(pop), k);
+    std::nth_element(std::begin(pop), end, std::end(pop), compFunctor);
+    std::sort(std::begin(pop), end, compFunctor);
+  }
 };
 }
 }
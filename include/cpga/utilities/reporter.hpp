@@ -41,6 +41,8 @@ class time_reporter_state : public reporter_state {
 
   void write_info(const time_point &end, actor_phase phase,
                   size_t generation, island_id island);
+
+  void write_migration_policy(const time_point &time, size_t generation, size_t period, size_t quota);
 };
 
 template<typename individual, typename fitness_value>
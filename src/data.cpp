@@ -8,7 +8,26 @@ namespace cpga {
 namespace core {
 system_properties::system_properties() : total_population_size{0},
                                          population_size{0},
-                                         islands_number{0} {}
+                                         islands_number{0},
+                                         fitness_batch_size{1},
+                                         is_pull_dispatch_active{false},
+                                         is_load_aware_dispatch_active{false},
+                                         grid_batches_per_worker{4},
+                                         request_timeout{timeout},
+                                         straggler_percentile{0},
+                                         is_steady_state_active{false},
+                                         is_async_island_active{false},
+                                         termination_check_period{1},
+                                         is_island_rebalancing_active{false},
+                                         is_adaptive_migration_active{false},
+                                         island_evaluators_number{0},
+                                         is_grid_partition_persistent{false},
+                                         grid_exchange_fraction{0.1},
+                                         fitness_cache_capacity{10000},
+                                         is_evaluation_tracking_active{false},
+                                         grid_rows{0},
+                                         grid_columns{0},
+                                         neighbourhood{cellular_neighbourhood::VON_NEUMANN} {}
 
 configuration::configuration(const system_properties &system_props,
                              const user_properties &user_props,
@@ -30,6 +30,7 @@ void caf_main(actor_system &system, const cluster_properties &cluster_props) {
   system_props.mutation_probability = 0.2;
   // optional routines of a pga
   system_props.is_elitism_active = true;
+  system_props.is_evaluation_tracking_active = true;
   system_props.is_survival_selection_active = false;
   system_props.is_migration_active = true;
   system_props.can_repeat_individual_elements = true;
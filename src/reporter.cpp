@@ -106,6 +106,16 @@ behavior reporter(stateful_actor<reporter_state> *self) {
   };
 }
 
+void time_reporter_state::write_migration_policy(const time_point &time, size_t generation,
+                                                 size_t period, size_t quota) {
+  using namespace std::chrono;
+  auto t = time_point_cast<milliseconds>(time).time_since_epoch().count();
+
+  *out_stream << t << delimiter << t << delimiter << 0
+              << delimiter << "migration_policy(period=" << period << ";quota=" << quota << ")"
+              << delimiter << generation << delimiter << island_special << std::endl;
+}
+
 behavior time_reporter(stateful_actor<time_reporter_state> *self) {
   return {
       [=](init_reporter, const std::string &file, const std::vector<std::string> &headers) {
@@ -121,6 +131,9 @@ behavior time_reporter(stateful_actor<time_reporter_state> *self) {
       [=](note_end, const time_point &end, actor_phase phase, size_t generation, island_id island) {
         self->state.write_info(end, phase, generation, island);
       },
+      [=](report_migration_policy, const time_point &time, size_t generation, size_t period, size_t quota) {
+        self->state.write_migration_policy(time, generation, period, quota);
+      },
   };
 }
 
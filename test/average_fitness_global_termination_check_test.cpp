@@ -88,4 +88,21 @@ TEST_CASE("average_fitness_global_termination_check exhibits correct behaviour",
       REQUIRE(!should_stop);
     }
   }
-}
\ No newline at end of file
+
+  SECTION("when checking fitness statistics") {
+    size_t stable_required = 2;
+    int average_fitness_value = 10;
+
+    auto config = shared_config_builder(cpga::pga_model::GLOBAL)
+        .withUserProperty(cpga::strings::STABLE_REQUIRED, stable_required)
+        .withUserProperty(cpga::strings::MINIMUM_AVERAGE, average_fitness_value)
+        .build();
+
+    cpga::operators::average_fitness_global_termination_check<int, int> termination_check{config, cpga::island_0};
+
+    REQUIRE(termination_check(cpga::fitness_statistics<int>{0, 0, 0, 0.0}));
+    REQUIRE(!termination_check(cpga::fitness_statistics<int>{200, 20, 15, 0.0}));
+    REQUIRE(termination_check(cpga::fitness_statistics<int>{220, 20, 15, 0.0}));
+    REQUIRE(!termination_check(cpga::fitness_statistics<int>{180, 20, 15, 0.0}));
+  }
+}
@@ -0,0 +1,90 @@
+#include "catch2/catch.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cpga/operators/cached_fitness_evaluation.hpp>
+
+namespace {
+struct counting_fitness_evaluation : cpga::core::base_operator {
+  using cpga::core::base_operator::base_operator;
+
+  static size_t calls;
+
+  int operator()(const std::vector<int> &ind) const noexcept {
+    ++calls;
+    return std::accumulate(std::begin(ind), std::end(ind), 0);
+  }
+};
+
+size_t counting_fitness_evaluation::calls = 0;
+
+struct colliding_hash {
+  size_t operator()(const std::vector<int> &ind) const noexcept {
+    return 0;
+  }
+};
+
+using cached_evaluation = cpga::operators::cached_fitness_evaluation<std::vector<int>, int,
+                                                                     counting_fitness_evaluation>;
+}
+
+TEST_CASE("cached_fitness_evaluation exhibits correct behaviour", "[cached_fitness_evaluation]") {
+  SECTION("when the same individual is evaluated by different operators") {
+    auto config = shared_config_builder(cpga::pga_model::ISLAND)
+        .withPopulationSize(10)
+        .withFitnessCacheCapacity(16)
+        .build();
+
+    cached_evaluation first{config, 0};
+    cached_evaluation second{config, 1};
+
+    counting_fitness_evaluation::calls = 0;
+
+    REQUIRE(first({1, 2, 3}) == 6);
+    REQUIRE(first({1, 2, 3}) == 6);
+    REQUIRE(second({1, 2, 3}) == 6);
+    REQUIRE(second({3, 2, 2}) == 7);
+
+    REQUIRE(counting_fitness_evaluation::calls == 2);
+    REQUIRE(cpga::has_statistics<decltype(first)>::value);
+  }
+
+  SECTION("when the same individual is evaluated in different runs") {
+    auto first_config = shared_config_builder(cpga::pga_model::ISLAND)
+        .withPopulationSize(10)
+        .withFitnessCacheCapacity(16)
+        .build();
+    auto second_config = shared_config_builder(cpga::pga_model::ISLAND)
+        .withPopulationSize(10)
+        .withFitnessCacheCapacity(0)
+        .build();
+
+    cached_evaluation first{first_config, 0};
+    cached_evaluation second{second_config, 0};
+
+    counting_fitness_evaluation::calls = 0;
+
+    REQUIRE(first({1, 2, 3}) == 6);
+    REQUIRE(second({1, 2, 3}) == 6);
+    REQUIRE(second({1, 2, 3}) == 6);
+
+    REQUIRE(counting_fitness_evaluation::calls == 3);
+  }
+
+  SECTION("when different individuals have the same hash") {
+    auto config = shared_config_builder(cpga::pga_model::ISLAND)
+        .withPopulationSize(10)
+        .withFitnessCacheCapacity(16)
+        .build();
+
+    cpga::operators::cached_fitness_evaluation<std::vector<int>, int, counting_fitness_evaluation, colliding_hash>
+        evaluation{config, 0};
+
+    counting_fitness_evaluation::calls = 0;
+
+    REQUIRE(evaluation({1, 2, 3}) == 6);
+    REQUIRE(evaluation({3, 2, 2}) == 7);
+    REQUIRE(evaluation({3, 2, 2}) == 7);
+    REQUIRE(evaluation({1, 2, 3}) == 6);
+
+    REQUIRE(counting_fitness_evaluation::calls == 3);
+  }
+}
@@ -0,0 +1,138 @@
+#include "catch2/catch.hpp"
+#include <set>
+#include <cpga/models/cellular_model.hpp>
+#include "helpers/shared_config_builder.hpp"
+
+namespace {
+// The tested members of the worker state never call the operators
+struct unused_operator {
+  unused_operator() = default;
+  unused_operator(const cpga::core::shared_config &config, cpga::island_id island_no) {
+  }
+};
+
+using worker_state = cpga::models::cellular_model_worker_state<int, int,
+                                                               unused_operator, unused_operator, unused_operator>;
+
+const long grid_rows{4};
+const long grid_columns{5};
+
+// The index of the cell at row and column of the torus, every cell holds its own index as fitness value
+int torus_index(long row, long column) {
+  return static_cast<int>(((row + grid_rows) % grid_rows) * grid_columns + (column + grid_columns) % grid_columns);
+}
+
+// Split the grid into tiles the way the executor does and fill the halo rows the way the workers exchange them
+std::vector<worker_state> make_tiles(const cpga::core::shared_config &config,
+                                     size_t tiles,
+                                     std::vector<long> &first_rows) {
+  std::vector<worker_state> states;
+  auto per_tile = grid_rows / tiles;
+  auto remainder = grid_rows % tiles;
+
+  first_rows.clear();
+  for (size_t i = 0, row = 0; i < tiles; ++i) {
+    states.emplace_back(config, cpga::island_id{i});
+    first_rows.push_back(row);
+
+    for (auto end = row + per_tile + (i < remainder ? 1 : 0); row < end; ++row) {
+      for (long column = 0; column < grid_columns; ++column) {
+        states.back().tile.emplace_back(0, torus_index(row, column));
+      }
+    }
+  }
+
+  for (size_t i = 0; i < tiles; ++i) {
+    const auto &above = states[(i + tiles - 1) % tiles].tile;
+    const auto &below = states[(i + 1) % tiles].tile;
+
+    states[i].halo_above.assign(std::prev(above.end(), grid_columns), above.end());
+    states[i].halo_below.assign(below.begin(), std::next(below.begin(), grid_columns));
+  }
+
+  return states;
+}
+
+void require_mates_are_neighbours(cpga::cellular_neighbourhood neighbourhood, size_t tiles) {
+  std::vector<long> first_rows;
+  auto config = shared_config_builder(cpga::pga_model::CELLULAR)
+      .withGridRows(grid_rows)
+      .withGridColumns(grid_columns)
+      .withIslandsNumber(tiles)
+      .withNeighbourhood(neighbourhood)
+      .build();
+  auto states = make_tiles(config, tiles, first_rows);
+  auto reach = neighbourhood == cpga::cellular_neighbourhood::MOORE ? 2 : 1;
+
+  for (size_t i = 0; i < tiles; ++i) {
+    auto &state = states[i];
+
+    for (long row = 0; row < static_cast<long>(state.rows()); ++row) {
+      for (long column = 0; column < grid_columns; ++column) {
+        auto global_row = first_rows[i] + row;
+
+        std::set<int> neighbours;
+        for (long dr = -1; dr <= 1; ++dr) {
+          for (long dc = -1; dc <= 1; ++dc) {
+            if ((dr || dc) && std::abs(dr) + std::abs(dc) <= reach) {
+              neighbours.insert(torus_index(global_row + dr, column + dc));
+            }
+          }
+        }
+
+        std::set<int> mates;
+        for (int draw = 0; draw < 200; ++draw) {
+          mates.insert(state.select_mate(row, column).second);
+        }
+
+        REQUIRE(std::includes(neighbours.begin(), neighbours.end(), mates.begin(), mates.end()));
+        REQUIRE(mates.count(*neighbours.rbegin()));
+      }
+    }
+  }
+}
+}
+
+TEST_CASE("cellular model worker exhibits correct behaviour", "[cellular_model]") {
+  SECTION("cellular model requires workers to own the tiles") {
+    REQUIRE_THROWS(shared_config_builder(cpga::pga_model::CELLULAR)
+                       .withGridRows(grid_rows)
+                       .withGridColumns(grid_columns)
+                       .withIslandsNumber(0)
+                       .build());
+  }
+
+  SECTION("cell() wraps columns around and reads the halo rows beyond the tile") {
+    for (size_t tiles : {1, 2, 3, 4}) {
+      std::vector<long> first_rows;
+      auto config = shared_config_builder(cpga::pga_model::CELLULAR)
+          .withGridRows(grid_rows)
+          .withGridColumns(grid_columns)
+          .withIslandsNumber(tiles)
+          .build();
+      auto states = make_tiles(config, tiles, first_rows);
+
+      for (size_t i = 0; i < tiles; ++i) {
+        const auto &state = states[i];
+
+        for (long row = -1; row <= static_cast<long>(state.rows()); ++row) {
+          for (long column = -1; column <= grid_columns; ++column) {
+            REQUIRE(state.cell(row, column).second == torus_index(first_rows[i] + row, column));
+          }
+        }
+      }
+    }
+  }
+
+  SECTION("select_mate() picks von Neumann neighbours, also when the tiles above and below are the same") {
+    for (size_t tiles : {1, 2, 4}) {
+      require_mates_are_neighbours(cpga::cellular_neighbourhood::VON_NEUMANN, tiles);
+    }
+  }
+
+  SECTION("select_mate() picks Moore neighbours, also when the tiles above and below are the same") {
+    for (size_t tiles : {1, 2, 4}) {
+      require_mates_are_neighbours(cpga::cellular_neighbourhood::MOORE, tiles);
+    }
+  }
+}
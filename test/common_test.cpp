@@ -114,4 +114,82 @@ TEST_CASE("join concatenates sequences correctly correctly", "[join]") {
 
     REQUIRE(cpga::join(items) == expected);
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("population_snapshot shares its individuals", "[population_snapshot]") {
+  cpga::population_snapshot<int> snapshot{std::make_shared<std::vector<int>>(std::vector<int>{1, 2, 3, 4, 5})};
+  auto copy{snapshot};
+
+  REQUIRE(copy.individuals == snapshot.individuals);
+  REQUIRE(snapshot.slice(1, 4) == std::vector<int>{2, 3, 4});
+  REQUIRE(snapshot.slice(2, 2).empty());
+}
+
+TEST_CASE("population_snapshot takes individuals from a population and gives them back", "[population_snapshot]") {
+  using individual = std::vector<int>;
+
+  cpga::population<individual, int> pop{{{1, 1}, 2}, {{2, 2}, 4}, {{3, 3}, 6}};
+  std::vector<size_t> indices{0, 2};
+
+  auto snapshot = cpga::make_snapshot(pop, indices);
+
+  REQUIRE(*snapshot.individuals == std::vector<individual>{{1, 1}, {3, 3}});
+  REQUIRE(pop[1].first == individual{2, 2});
+
+  SECTION("when no one else holds the snapshot the individuals are moved back") {
+    auto data = (*snapshot.individuals)[0].data();
+
+    cpga::restore_snapshot(pop, indices, snapshot);
+
+    REQUIRE(pop[0].first.data() == data);
+    REQUIRE(pop[0] == std::make_pair(individual{1, 1}, 2));
+    REQUIRE(pop[2] == std::make_pair(individual{3, 3}, 6));
+  }
+
+  SECTION("when someone else still holds the snapshot the individuals are copied back") {
+    auto reader{snapshot};
+
+    cpga::restore_snapshot(pop, indices, snapshot);
+
+    REQUIRE(pop[0].first == individual{1, 1});
+    REQUIRE(pop[2].first == individual{3, 3});
+    REQUIRE(reader.slice(0, 2) == std::vector<individual>{{1, 1}, {3, 3}});
+  }
+}
+
+TEST_CASE("fitness_statistics combine correctly", "[fitness_statistics]") {
+  SECTION("for a population") {
+    cpga::population<int, int> pop{{1, 4}, {2, 9}, {3, 2}};
+    auto statistics = cpga::make_statistics(pop);
+
+    REQUIRE(statistics.sum == 15);
+    REQUIRE(statistics.count == 3);
+    REQUIRE(statistics.best == 9);
+    REQUIRE(statistics.sum_of_squares == 101);
+  }
+
+  SECTION("when squares of fitness values do not fit the fitness value type") {
+    cpga::population<int, int> pop(10000, {1, 1000});
+    auto statistics = cpga::make_statistics(pop);
+
+    REQUIRE(statistics.sum == 10000000);
+    REQUIRE(statistics.sum_of_squares == Approx(1e10));
+  }
+
+  SECTION("for an empty population") {
+    auto statistics = cpga::make_statistics(cpga::population<int, int>{});
+
+    REQUIRE(statistics.count == 0);
+  }
+
+  SECTION("when merging statistics of several populations") {
+    auto statistics = cpga::make_statistics(cpga::population<int, int>{{1, -3}, {2, -1}});
+
+    statistics.merge(cpga::make_statistics(cpga::population<int, int>{}));
+    statistics.merge(cpga::make_statistics(cpga::population<int, int>{{3, -2}}));
+
+    REQUIRE(statistics.sum == -6);
+    REQUIRE(statistics.count == 3);
+    REQUIRE(statistics.best == -1);
+  }
+}
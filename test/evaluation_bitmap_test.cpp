@@ -0,0 +1,61 @@
+#include "catch2/catch.hpp"
+#include "helpers/population_helper.hpp"
+#include <cpga/utilities/evaluation_bitmap.hpp>
+
+TEST_CASE("evaluation_bitmap exhibits correct behaviour", "[evaluation_bitmap]") {
+  auto evaluation = [](int ind) {
+    return ind * 3;
+  };
+
+  SECTION("when only part of the population is evaluated") {
+    cpga::population<int, int> pop{population_helper::sample_population(5)};
+    cpga::utilities::evaluation_bitmap evaluated;
+
+    evaluated.assign(3, false);
+    evaluated.append(2, true);
+
+    REQUIRE(evaluated.pending(pop.size()) == std::vector<size_t>{0, 1, 2});
+    REQUIRE(evaluated.evaluate(pop, evaluation) == 3);
+    REQUIRE(pop[0].second == 3);
+    REQUIRE(pop[2].second == 9);
+    REQUIRE(pop[3].second == 8);
+    REQUIRE(pop[4].second == 10);
+    REQUIRE(evaluated.pending(pop.size()).empty());
+  }
+
+  SECTION("when the population outgrows the bitmap") {
+    cpga::population<int, int> pop{population_helper::sample_population(4)};
+    cpga::utilities::evaluation_bitmap evaluated;
+
+    evaluated.assign(2, true);
+
+    REQUIRE(evaluated.evaluate(pop, evaluation) == 2);
+    REQUIRE(pop[1].second == 4);
+    REQUIRE(pop[3].second == 12);
+  }
+
+  SECTION("when the bitmap is invalidated") {
+    cpga::population<int, int> pop{population_helper::sample_population(4)};
+    cpga::utilities::evaluation_bitmap evaluated;
+
+    evaluated.assign(4, true);
+    evaluated.invalidate();
+
+    REQUIRE(evaluated.evaluate(pop, evaluation) == 4);
+    REQUIRE(pop[1].second == 6);
+  }
+
+  SECTION("when only some members are marked as evaluated") {
+    cpga::utilities::evaluation_bitmap evaluated;
+
+    evaluated.assign(4, false);
+    evaluated.mark({1, 3});
+
+    REQUIRE(evaluated.pending(4) == std::vector<size_t>{0, 2});
+
+    evaluated.mark({5});
+
+    REQUIRE(evaluated.size() == 6);
+    REQUIRE(evaluated.pending(6) == std::vector<size_t>{0, 2, 4});
+  }
+}
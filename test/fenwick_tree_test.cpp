@@ -0,0 +1,40 @@
+#include "catch2/catch.hpp"
+#include <cpga/utilities/fenwick_tree.hpp>
+
+TEST_CASE("fenwick_tree exhibits correct behaviour", "[fenwick_tree]") {
+  cpga::utilities::fenwick_tree<int> tree{{1, 0, 3, 2, 4}};
+
+  REQUIRE(tree.size() == 5);
+  REQUIRE(tree.total() == 10);
+
+  SECTION("when finding the element a point falls into") {
+    REQUIRE(tree.find(0) == 0);
+    REQUIRE(tree.find(1) == 2);
+    REQUIRE(tree.find(3) == 2);
+    REQUIRE(tree.find(4) == 3);
+    REQUIRE(tree.find(5) == 3);
+    REQUIRE(tree.find(6) == 4);
+    REQUIRE(tree.find(9) == 4);
+    REQUIRE(tree.find(10) == 5);
+  }
+
+  SECTION("when weights are changed") {
+    tree.add(2, -3);
+    tree.add(1, 5);
+
+    REQUIRE(tree.total() == 12);
+    REQUIRE(tree.find(0) == 0);
+    REQUIRE(tree.find(1) == 1);
+    REQUIRE(tree.find(5) == 1);
+    REQUIRE(tree.find(6) == 3);
+    REQUIRE(tree.find(8) == 4);
+  }
+
+  SECTION("when empty") {
+    cpga::utilities::fenwick_tree<int> empty{std::vector<int>{}};
+
+    REQUIRE(empty.size() == 0);
+    REQUIRE(empty.total() == 0);
+    REQUIRE(empty.find(0) == 0);
+  }
+}
@@ -0,0 +1,103 @@
+#include "catch2/catch.hpp"
+#include <cpga/utilities/fitness_cache.hpp>
+
+TEST_CASE("fitness_cache exhibits correct behaviour", "[fitness_cache]") {
+  SECTION("when looking up a stored and a missing hash") {
+    cpga::utilities::fitness_cache<std::vector<int>, int> cache{4};
+    int value{0};
+
+    cache.insert(1, {1}, 10);
+
+    REQUIRE(cache.find(1, {1}, value));
+    REQUIRE(value == 10);
+    REQUIRE(!cache.find(2, {2}, value));
+    REQUIRE(value == 10);
+  }
+
+  SECTION("when a different individual has the hash of a stored one") {
+    cpga::utilities::fitness_cache<std::vector<int>, int> cache{4};
+    int value{0};
+
+    cache.insert(1, {1, 2}, 10);
+
+    REQUIRE(!cache.find(1, {2, 1}, value));
+    REQUIRE(value == 0);
+
+    cache.insert(1, {2, 1}, 20);
+
+    REQUIRE(cache.size() == 1);
+    REQUIRE(!cache.find(1, {1, 2}, value));
+    REQUIRE(cache.find(1, {2, 1}, value));
+    REQUIRE(value == 20);
+  }
+
+  SECTION("when the capacity is exceeded the least recently used entry is evicted") {
+    cpga::utilities::fitness_cache<std::vector<int>, int> cache{2};
+    int value{0};
+
+    cache.insert(1, {1}, 10);
+    cache.insert(2, {2}, 20);
+    REQUIRE(cache.find(1, {1}, value));
+    cache.insert(3, {3}, 30);
+
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.find(1, {1}, value));
+    REQUIRE(value == 10);
+    REQUIRE(!cache.find(2, {2}, value));
+    REQUIRE(cache.find(3, {3}, value));
+    REQUIRE(value == 30);
+  }
+
+  SECTION("when the capacity is 0 nothing is stored") {
+    cpga::utilities::fitness_cache<std::vector<int>, int> cache{0};
+    int value{0};
+
+    cache.insert(1, {1}, 10);
+
+    REQUIRE(cache.size() == 0);
+    REQUIRE(!cache.find(1, {1}, value));
+  }
+}
+
+TEST_CASE("individual_hash hashes individuals by value", "[individual_hash]") {
+  struct params {
+    double c;
+    double gamma;
+  };
+
+  SECTION("for sequence individuals") {
+    cpga::utilities::individual_hash<std::vector<char>> hash;
+
+    REQUIRE(hash({0, 1, 1}) == hash({0, 1, 1}));
+    REQUIRE(hash({0, 1, 1}) != hash({1, 1, 0}));
+  }
+
+  SECTION("for trivially copyable individuals") {
+    cpga::utilities::individual_hash<params> hash;
+
+    REQUIRE(hash({1.0, 0.5}) == hash({1.0, 0.5}));
+    REQUIRE(hash({1.0, 0.5}) != hash({0.5, 1.0}));
+  }
+}
+
+TEST_CASE("individual_equal compares individuals by value", "[individual_equal]") {
+  struct params {
+    double c;
+    double gamma;
+  };
+
+  SECTION("for sequence individuals") {
+    cpga::utilities::individual_equal<std::vector<char>> equal;
+
+    REQUIRE(equal({0, 1, 1}, {0, 1, 1}));
+    REQUIRE(!equal({0, 1, 1}, {1, 1, 0}));
+    REQUIRE(!equal({0, 1, 1}, {0, 1}));
+  }
+
+  SECTION("for trivially copyable individuals") {
+    cpga::utilities::individual_equal<params> equal;
+
+    REQUIRE(equal({1.0, 0.5}, {1.0, 0.5}));
+    REQUIRE(!equal({1.0, 0.5}, {0.5, 1.0}));
+  }
+}
@@ -19,6 +19,8 @@ shared_config_builder::shared_config_builder(cpga::pga_model model) :
       break;
     case cpga::pga_model::SEQUENTIAL:system_props.sequential_model();
       break;
+    case cpga::pga_model::CELLULAR:system_props.cellular_model();
+      break;
   }
 
   system_props.initialization_seed = random_one();
@@ -108,6 +110,26 @@ shared_config_builder &shared_config_builder::withMutationProbability(double pro
   return *this;
 }
 
+shared_config_builder &shared_config_builder::withFitnessCacheCapacity(size_t capacity) {
+  system_props.fitness_cache_capacity = capacity;
+  return *this;
+}
+
+shared_config_builder &shared_config_builder::withGridRows(size_t grid_rows) {
+  system_props.grid_rows = grid_rows;
+  return *this;
+}
+
+shared_config_builder &shared_config_builder::withGridColumns(size_t grid_columns) {
+  system_props.grid_columns = grid_columns;
+  return *this;
+}
+
+shared_config_builder &shared_config_builder::withNeighbourhood(cpga::cellular_neighbourhood neighbourhood) {
+  system_props.neighbourhood = neighbourhood;
+  return *this;
+}
+
 cpga::core::shared_config shared_config_builder::build() {
   system_props.compute_population_size();
   return cpga::core::make_shared_config(system_props, user_props, cpga::core::message_bus{});
@@ -34,6 +34,10 @@ class shared_config_builder {
   shared_config_builder &addingIslandNosToSeed(bool active);
   shared_config_builder &withCrossoverProbability(double probability);
   shared_config_builder &withMutationProbability(double probability);
+  shared_config_builder &withFitnessCacheCapacity(size_t capacity);
+  shared_config_builder &withGridRows(size_t grid_rows);
+  shared_config_builder &withGridColumns(size_t grid_columns);
+  shared_config_builder &withNeighbourhood(cpga::cellular_neighbourhood neighbourhood);
 
   template<typename T>
   shared_config_builder &withUserProperty(std::string key, T &&prop) {
@@ -0,0 +1,40 @@
+#include "catch2/catch.hpp"
+#include <cpga/models/island_model.hpp>
+
+TEST_CASE("island model executor exhibits correct behaviour", "[island_model]") {
+  // Runs the periods the executor would, returning the number of generations run
+  auto run = [](size_t period, size_t generations_number) {
+    size_t generations_so_far{0};
+    size_t periods{0};
+
+    for (auto next = cpga::models::next_period(period, 0, generations_number); next;
+         next = cpga::models::next_period(period, generations_so_far, generations_number)) {
+      generations_so_far += next;
+      REQUIRE(++periods <= generations_number);
+    }
+
+    return generations_so_far;
+  };
+
+  SECTION("when the migration period divides the number of generations") {
+    REQUIRE(run(5, 20) == 20);
+  }
+
+  SECTION("when the last period is shorter than the migration period") {
+    REQUIRE(run(3, 10) == 10);
+    REQUIRE(cpga::models::next_period(3, 9, 10) == 1);
+  }
+
+  SECTION("when the migration period is larger than the number of generations") {
+    REQUIRE(cpga::models::next_period(15, 0, 10) == 10);
+    REQUIRE(run(15, 10) == 10);
+  }
+
+  SECTION("when more generations than generations_number have been run") {
+    REQUIRE(cpga::models::next_period(5, 12, 10) == 0);
+  }
+
+  SECTION("when there are no generations to run") {
+    REQUIRE(run(5, 0) == 0);
+  }
+}
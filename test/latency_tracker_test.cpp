@@ -0,0 +1,41 @@
+#include "catch2/catch.hpp"
+#include <cpga/utilities/latency_tracker.hpp>
+
+TEST_CASE("latency_tracker exhibits correct behaviour", "[latency_tracker]") {
+  using namespace std::chrono_literals;
+
+  SECTION("when too few latencies are recorded") {
+    cpga::utilities::latency_tracker latencies;
+
+    latencies.record(5ms);
+
+    REQUIRE(latencies.size() == 1);
+    REQUIRE_FALSE(latencies.percentile(0.5, 2).has_value());
+    REQUIRE(latencies.percentile(0.5, 1).value() == 5ms);
+  }
+
+  SECTION("when percentiles are computed") {
+    cpga::utilities::latency_tracker latencies;
+
+    for (int i = 10; i > 0; --i) {
+      latencies.record(std::chrono::milliseconds(i));
+    }
+
+    REQUIRE(latencies.percentile(0.0, 10).value() == 1ms);
+    REQUIRE(latencies.percentile(0.5, 10).value() == 5ms);
+    REQUIRE(latencies.percentile(0.9, 10).value() == 9ms);
+    REQUIRE(latencies.percentile(1.0, 10).value() == 10ms);
+  }
+
+  SECTION("when the window is full") {
+    cpga::utilities::latency_tracker latencies{4};
+
+    for (int i = 1; i <= 6; ++i) {
+      latencies.record(std::chrono::milliseconds(i));
+    }
+
+    REQUIRE(latencies.size() == 4);
+    REQUIRE(latencies.percentile(0.0, 4).value() == 3ms);
+    REQUIRE(latencies.percentile(1.0, 4).value() == 6ms);
+  }
+}
@@ -0,0 +1,138 @@
+#include "catch2/catch.hpp"
+#include "helpers/population_helper.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cpga/operators/linear_ranking_parent_selection.hpp>
+#include <cpga/operators/linear_ranking_survival_selection.hpp>
+
+namespace {
+const size_t draws{20000};
+
+using survival_type = cpga::operators::linear_ranking_survival_selection<int, int>;
+
+// The chance that the member of the given rank, counted from the worst one, is drawn among size members
+double rank_chance(size_t rank, size_t size, double pressure) {
+  return survival_type::rank_weight(rank, size, pressure) / (size * (size - 1.0));
+}
+
+cpga::core::shared_config make_config(double pressure) {
+  return shared_config_builder(cpga::pga_model::GLOBAL)
+      .withUserProperty(cpga::strings::SELECTION_PRESSURE, pressure)
+      .build();
+}
+}
+
+TEST_CASE("linear_ranking_parent_selection exhibits correct behaviour", "[linear_ranking_parent_selection]") {
+  SECTION("when members are drawn in proportion to their rank weight") {
+    // Every fitness value is the rank of its member
+    cpga::population<int, int> main{{0, 3}, {1, 0}, {2, 2}, {3, 1}};
+
+    for (double pressure : {1.0, 1.5, 2.0}) {
+      cpga::operators::linear_ranking_parent_selection<int, int> selection{make_config(pressure), cpga::island_0};
+      std::vector<size_t> wins(main.size(), 0);
+
+      for (size_t i = 0; i < draws / 2; ++i) {
+        cpga::couples<int, int> couples;
+
+        selection(main, couples);
+
+        for (const auto &couple : couples) {
+          ++wins[couple.first.second];
+        }
+      }
+
+      for (size_t rank = 0; rank < main.size(); ++rank) {
+        REQUIRE(wins[rank] / static_cast<double>(draws) == Approx(rank_chance(rank, main.size(), pressure))
+            .margin(0.02));
+      }
+    }
+  }
+
+  SECTION("when fitness values are minimized") {
+    cpga::operators::linear_ranking_parent_selection<int, int, std::greater<int>> selection{make_config(2.0),
+                                                                                            cpga::island_0};
+    cpga::population<int, int> main{{1, -7}, {2, 30}, {3, -2}, {4, 5}};
+    cpga::couples<int, int> couples;
+
+    for (int i = 0; i < 100; ++i) {
+      selection(main, couples);
+    }
+
+    REQUIRE(std::none_of(std::begin(couples), std::end(couples), [](const auto &couple) {
+      return couple.first.first == 2;
+    }));
+  }
+
+  SECTION("when the population is too small") {
+    cpga::operators::linear_ranking_parent_selection<int, int> selection{make_config(2.0), cpga::island_0};
+    cpga::population<int, int> main{{1, 1}};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.empty());
+  }
+}
+
+TEST_CASE("linear_ranking_survival_selection exhibits correct behaviour", "[linear_ranking_survival_selection]") {
+  SECTION("rank_weight() follows (2 - p)(n - 1) + 2(p - 1) rank") {
+    for (size_t rank = 0; rank < 5; ++rank) {
+      REQUIRE(survival_type::rank_weight(rank, 5, 1.0) == Approx(4.0));
+      REQUIRE(survival_type::rank_weight(rank, 5, 1.5) == Approx(2.0 + rank));
+      REQUIRE(survival_type::rank_weight(rank, 5, 2.0) == Approx(2.0 * rank));
+    }
+
+    for (double pressure : {1.0, 1.2, 1.5, 1.8, 2.0}) {
+      double sum{0.0};
+      for (size_t rank = 0; rank < 10; ++rank) {
+        sum += survival_type::rank_weight(rank, 10, pressure);
+      }
+
+      REQUIRE(sum == Approx(10 * 9));
+    }
+  }
+
+  SECTION("when members survive in proportion to their rank weight") {
+    for (double pressure : {1.0, 1.5, 2.0}) {
+      survival_type selection{make_config(pressure), cpga::island_0};
+      std::vector<size_t> wins(4, 0);
+      size_t mismatches{0};
+
+      for (size_t i = 0; i < draws; ++i) {
+        // A single parent leaves a single survivor, every fitness value is the rank of its member
+        cpga::population<int, int> parents{{0, 2}};
+        cpga::population<int, int> offspring{{1, 0}, {2, 3}, {3, 1}};
+
+        selection(parents, offspring);
+
+        mismatches += offspring.size() != 1;
+        ++wins[offspring.front().second];
+      }
+
+      REQUIRE(mismatches == 0);
+
+      for (size_t rank = 0; rank < wins.size(); ++rank) {
+        REQUIRE(wins[rank] / static_cast<double>(draws) == Approx(rank_chance(rank, wins.size(), pressure))
+            .margin(0.02));
+      }
+    }
+  }
+
+  SECTION("when the worst member has no chance to survive") {
+    survival_type selection{make_config(2.0), cpga::island_0};
+    cpga::population<int, int> parents{{1, 4}, {2, -3}, {3, 0}};
+    cpga::population<int, int> offspring{{4, 2}, {5, 8}, {6, 1}};
+
+    selection(parents, offspring);
+
+    std::vector<int> survivors;
+    std::transform(std::begin(offspring), std::end(offspring), std::back_inserter(survivors), [](const auto &m) {
+      return m.first;
+    });
+    std::sort(std::begin(survivors), std::end(survivors));
+
+    REQUIRE(parents.empty());
+    REQUIRE(survivors.size() == 3);
+    REQUIRE(std::find(std::begin(survivors), std::end(survivors), 2) == std::end(survivors));
+    REQUIRE(std::adjacent_find(std::begin(survivors), std::end(survivors)) == std::end(survivors));
+  }
+}
@@ -0,0 +1,103 @@
+#include "catch2/catch.hpp"
+#include <cpga/utilities/load_tracker.hpp>
+
+namespace {
+using clock_type = std::chrono::high_resolution_clock;
+
+/*
+ * Hand out a generation of batches to the workers at once, the way the grid model dispatcher does, and let
+ * each worker handle its batches one after another, cost being the time a worker takes per individual.
+ * Returns the number of individuals each worker was given.
+ */
+std::vector<size_t> run_generation(cpga::utilities::load_tracker &loads,
+                                   clock_type::time_point &clock,
+                                   const std::vector<std::chrono::microseconds> &cost,
+                                   size_t batches,
+                                   size_t batch_size) {
+  std::vector<std::vector<size_t>> assigned(cost.size());
+  std::vector<size_t> individuals(cost.size(), 0);
+
+  for (size_t b = 0; b < batches; ++b) {
+    auto i = loads.pick(batch_size);
+    loads.assign(i, batch_size, clock);
+    assigned[i].push_back(batch_size);
+    individuals[i] += batch_size;
+  }
+
+  auto generation_end = clock;
+  for (size_t i = 0; i < cost.size(); ++i) {
+    auto at = clock;
+    for (auto load : assigned[i]) {
+      at += cost[i] * load;
+      loads.complete(i, load, at);
+    }
+    generation_end = std::max(generation_end, at);
+  }
+
+  clock = generation_end;
+
+  return individuals;
+}
+}
+
+TEST_CASE("load_tracker exhibits correct behaviour", "[load_tracker]") {
+  using namespace std::chrono_literals;
+
+  SECTION("when no throughput is measured yet the least loaded worker is picked") {
+    cpga::utilities::load_tracker loads{3};
+    auto at = clock_type::now();
+
+    loads.assign(0, 10, at);
+    loads.assign(1, 5, at);
+    loads.assign(2, 7, at);
+
+    REQUIRE(loads.pick(1) == 1);
+
+    loads.release(1, 5);
+
+    REQUIRE(loads.outstanding(1) == 0);
+    REQUIRE(loads.pick(1) == 1);
+  }
+
+  SECTION("when a batch is completed the throughput of the worker is measured") {
+    cpga::utilities::load_tracker loads{1};
+    auto at = clock_type::now();
+
+    loads.assign(0, 10, at);
+    loads.assign(0, 10, at);
+    loads.complete(0, 10, at + 1s);
+    loads.complete(0, 10, at + 3s);
+
+    REQUIRE(loads.outstanding(0) == 0);
+    // 10 individuals per second, then 5 per second for the batch queued behind the first one
+    REQUIRE(loads.throughput(0) == Approx(7.5));
+  }
+
+  SECTION("when one of the workers is slow it is given fewer individuals") {
+    cpga::utilities::load_tracker loads{4};
+    auto clock = clock_type::now();
+    std::vector<std::chrono::microseconds> cost{10us, 10us, 10us, 40us};
+
+    auto first = run_generation(loads, clock, cost, 16, 10);
+
+    REQUIRE(first == std::vector<size_t>{40, 40, 40, 40});
+
+    auto second = run_generation(loads, clock, cost, 16, 10);
+
+    // The slow worker takes four times as long per individual
+    REQUIRE(second == std::vector<size_t>{50, 50, 50, 10});
+  }
+
+  SECTION("when a worker is removed the remaining ones keep their loads") {
+    cpga::utilities::load_tracker loads{3};
+    auto at = clock_type::now();
+
+    loads.assign(0, 10, at);
+    loads.assign(2, 3, at);
+    loads.remove(1);
+
+    REQUIRE(loads.size() == 2);
+    REQUIRE(loads.outstanding(1) == 3);
+    REQUIRE(loads.pick(1) == 1);
+  }
+}
@@ -0,0 +1,44 @@
+#include "catch2/catch.hpp"
+#include <cpga/utilities/migration_controller.hpp>
+
+TEST_CASE("migration_controller exhibits correct behaviour", "[migration_controller]") {
+  using statistics = cpga::fitness_statistics<double>;
+
+  cpga::utilities::migration_controller<double> controller{4, 4};
+
+  // Two islands of 10 individuals, the first time only best fitness values are remembered
+  controller.update({statistics{50, 10, 10, 500}, statistics{50, 10, 10, 500}});
+
+  REQUIRE(controller.current_period() == 4);
+  REQUIRE(controller.current_quota() == 4);
+
+  SECTION("when islands improve") {
+    controller.update({statistics{60, 10, 12, 600}, statistics{60, 10, 12, 600}});
+
+    REQUIRE(controller.current_period() == 8);
+    REQUIRE(controller.current_quota() == 3);
+
+    for (int i = 0; i < 10; ++i) {
+      controller.update({statistics{60, 10, 13.0 + i, 600}, statistics{60, 10, 13.0 + i, 600}});
+    }
+
+    REQUIRE(controller.current_period() == 16);
+    REQUIRE(controller.current_quota() == 1);
+  }
+
+  SECTION("when diverse islands stagnate") {
+    // Mean 5, standard deviation 3
+    controller.update({statistics{50, 10, 10, 340}, statistics{50, 10, 10, 340}});
+
+    REQUIRE(controller.current_period() == 2);
+    REQUIRE(controller.current_quota() == 5);
+  }
+
+  SECTION("when converged islands stagnate") {
+    // Mean 5, no spread
+    controller.update({statistics{50, 10, 5, 250}, statistics{50, 10, 5, 250}});
+
+    REQUIRE(controller.current_period() == 8);
+    REQUIRE(controller.current_quota() == 4);
+  }
+}
@@ -0,0 +1,39 @@
+#include "catch2/catch.hpp"
+#include <cpga/utilities/population_balancer.hpp>
+
+TEST_CASE("plan_population_transfers exhibits correct behaviour", "[population_balancer]") {
+  using namespace std::chrono_literals;
+  using cpga::utilities::plan_population_transfers;
+
+  SECTION("when islands are equally fast") {
+    REQUIRE(plan_population_transfers({100, 100, 100}, {2s, 2s, 2s}, 2).empty());
+  }
+
+  SECTION("when an island has no measurement yet") {
+    REQUIRE(plan_population_transfers({100, 100}, {1s, 0s}, 2).empty());
+  }
+
+  SECTION("when an island is slower than another") {
+    auto transfers = plan_population_transfers({100, 100}, {1s, 3s}, 2, 1.0);
+
+    REQUIRE(transfers.size() == 1);
+    REQUIRE(transfers[0].from == 1);
+    REQUIRE(transfers[0].to == 0);
+    REQUIRE(transfers[0].count == 50);
+  }
+
+  SECTION("when the difference is damped") {
+    auto transfers = plan_population_transfers({100, 100}, {1s, 3s}, 2, 0.5);
+
+    REQUIRE(transfers.size() == 1);
+    REQUIRE(transfers[0].count == 25);
+  }
+
+  SECTION("when a population would shrink below the minimum size") {
+    auto transfers = plan_population_transfers({10, 10}, {1ms, 100ms}, 8, 1.0);
+
+    REQUIRE(transfers.size() == 1);
+    REQUIRE(transfers[0].from == 1);
+    REQUIRE(transfers[0].count == 2);
+  }
+}
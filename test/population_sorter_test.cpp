@@ -28,4 +28,27 @@ TEST_CASE("population sorter sorts population in ascending order", "[population_
     REQUIRE(pop[0].second == sz * 2);
     REQUIRE(std::is_sorted(std::begin(pop), std::end(pop), comparator));
   }
-}
\ No newline at end of file
+
+  SECTION("moving the fittest members to the front") {
+    std::shuffle(std::begin(pop), std::end(pop), std::default_random_engine{});
+
+    cpga::utilities::population_sorter<int, int>::top(pop, 3);
+
+    REQUIRE(pop.size() == sz);
+    REQUIRE(pop[0].second == sz * 2);
+    REQUIRE(pop[1].second == sz * 2 - 2);
+    REQUIRE(pop[2].second == sz * 2 - 4);
+    REQUIRE(std::all_of(std::next(std::begin(pop), 3), std::end(pop), [](const auto &m) {
+      return m.second < sz * 2 - 4;
+    }));
+  }
+
+  SECTION("moving more members to the front than there are") {
+    std::shuffle(std::begin(pop), std::end(pop), std::default_random_engine{});
+
+    cpga::utilities::population_sorter<int, int>::top(pop, sz + 1);
+
+    REQUIRE(pop.size() == sz);
+    REQUIRE(std::is_sorted(std::begin(pop), std::end(pop), comparator));
+  }
+}
@@ -0,0 +1,79 @@
+#include "catch2/catch.hpp"
+#include "helpers/population_helper.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cpga/operators/ring_random_migration.hpp>
+
+TEST_CASE("ring_random_migration exhibits correct behaviour", "[ring_random_migration]") {
+  size_t sz = 10;
+  size_t islands_number = 3;
+  cpga::island_id island_no = 2;
+  cpga::population<int, int> main{population_helper::sample_population(sz)};
+
+  auto members = [](const auto &population) {
+    std::vector<int> members;
+    std::transform(std::begin(population), std::end(population), std::back_inserter(members), [](const auto &m) {
+      return m.first;
+    });
+    return members;
+  };
+
+  SECTION("when population size is larger than migration quota") {
+    auto config = shared_config_builder(cpga::pga_model::ISLAND)
+        .withTotalPopulationSize(sz)
+        .withIslandsNumber(islands_number)
+        .withMigration(true)
+        .withMigrationQuota(3)
+        .build();
+
+    cpga::operators::ring_random_migration<int, int> migration{config, island_no};
+
+    auto payload = migration(island_no, main);
+
+    REQUIRE(main.size() == sz - config->system_props.migration_quota);
+    REQUIRE(payload.size() == config->system_props.migration_quota);
+    REQUIRE(std::all_of(std::begin(payload), std::end(payload), [&](const auto &migrant) {
+      return migrant.first == (island_no + 1) % islands_number && migrant.second.second == migrant.second.first * 2;
+    }));
+
+    // Every member is either a migrant or left in the population, exactly once
+    auto left = members(main);
+    for (const auto &migrant : payload) {
+      left.push_back(migrant.second.first);
+    }
+    std::sort(std::begin(left), std::end(left));
+
+    REQUIRE(left == members(population_helper::sample_population(sz)));
+  }
+
+  SECTION("when population size is smaller than migration quota") {
+    auto config = shared_config_builder(cpga::pga_model::ISLAND)
+        .withTotalPopulationSize(sz)
+        .withIslandsNumber(islands_number)
+        .withMigration(true)
+        .withMigrationQuota(12)
+        .build();
+
+    cpga::operators::ring_random_migration<int, int> migration{config, island_no};
+
+    auto payload = migration(island_no, main);
+
+    REQUIRE(main.empty());
+    REQUIRE(payload.size() == sz);
+  }
+
+  SECTION("when the quota is given explicitly") {
+    auto config = shared_config_builder(cpga::pga_model::ISLAND)
+        .withTotalPopulationSize(sz)
+        .withIslandsNumber(islands_number)
+        .withMigration(true)
+        .withMigrationQuota(3)
+        .build();
+
+    cpga::operators::ring_random_migration<int, int> migration{config, island_no};
+
+    auto payload = migration(island_no, main, 5);
+
+    REQUIRE(main.size() == sz - 5);
+    REQUIRE(payload.size() == 5);
+  }
+}
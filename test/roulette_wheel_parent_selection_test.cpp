@@ -0,0 +1,107 @@
+#include "catch2/catch.hpp"
+#include "helpers/population_helper.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cpga/operators/roulette_wheel_parent_selection.hpp>
+
+TEST_CASE("roulette_wheel_parent_selection exhibits correct behaviour", "[roulette_wheel_parent_selection]") {
+  auto config = shared_config_builder(cpga::pga_model::GLOBAL).build();
+
+  cpga::operators::roulette_wheel_parent_selection<int, int> selection{config, cpga::island_0};
+
+  SECTION("when the population is populated") {
+    cpga::population<int, int> main{population_helper::sample_population(21)};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.size() == 10);
+    REQUIRE(std::all_of(std::begin(couples), std::end(couples), [](const auto &couple) {
+      return couple.first.first != couple.second.first;
+    }));
+  }
+
+  SECTION("when only one member has a non-zero fitness value") {
+    cpga::population<int, int> main{{1, 0}, {2, 0}, {3, 10}, {4, 0}};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.size() == 2);
+    REQUIRE(std::all_of(std::begin(couples), std::end(couples), [](const auto &couple) {
+      return couple.first == std::make_pair(3, 10) && couple.second == std::make_pair(4, 0);
+    }));
+  }
+
+  SECTION("when members are chosen in proportion to their fitness values") {
+    cpga::population<int, int> main{{1, 1}, {2, 3}};
+    cpga::couples<int, int> couples;
+
+    for (int i = 0; i < 1000; ++i) {
+      selection(main, couples);
+    }
+
+    auto first = std::count_if(std::begin(couples), std::end(couples), [](const auto &couple) {
+      return couple.first.first == 2;
+    });
+
+    REQUIRE(first > 650);
+    REQUIRE(first < 850);
+  }
+
+  SECTION("when the wheel is searched the member the linear scan stops at is found") {
+    using selection_type = cpga::operators::roulette_wheel_parent_selection<int, int>;
+
+    // The scan spin used to perform before cumulative fitness values were introduced
+    auto scan = [](const cpga::population<int, int> &population, double rand_fitness) {
+      size_t start{0};
+      while (rand_fitness > 0) {
+        rand_fitness -= population[start++].second;
+      }
+      return start - 1;
+    };
+
+    std::default_random_engine generator{42};
+    std::uniform_real_distribution<double> distribution{0.0, 1.0};
+
+    for (const auto &main : {cpga::population<int, int>{{1, 0}, {2, 0}, {3, 3}, {4, 0}, {5, 2}, {6, 0}, {7, 5}},
+                             cpga::population<int, int>{{1, 4}, {2, 4}, {3, 4}, {4, 4}},
+                             cpga::population<int, int>{{1, 1}, {2, 0}, {3, 0}, {4, 9}, {5, 0}}}) {
+      std::vector<int> cumulative;
+      int total{0};
+      for (const auto &member : main) {
+        cumulative.push_back(total += member.second);
+      }
+
+      // Draws falling exactly on the boundaries between members are ties the search has to break alike
+      size_t mismatches{0};
+      for (int boundary = 1; boundary < total; ++boundary) {
+        mismatches += selection_type::find(cumulative, static_cast<double>(boundary)) != scan(main, boundary);
+      }
+
+      for (int draw = 0; draw < 10000; ++draw) {
+        auto point = distribution(generator) * total;
+
+        if (point > 0) {
+          mismatches += selection_type::find(cumulative, point) != scan(main, point);
+        }
+      }
+
+      REQUIRE(mismatches == 0);
+
+      // A zero draw stops the scan before the first member, the search picks the first one with fitness
+      auto first_fit = std::distance(std::begin(main), std::find_if(std::begin(main), std::end(main), [](auto &m) {
+        return m.second > 0;
+      }));
+      REQUIRE(selection_type::find(cumulative, 0.0) == static_cast<size_t>(first_fit));
+    }
+  }
+
+  SECTION("when the population is too small") {
+    cpga::population<int, int> main{{1, 1}};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.empty());
+  }
+}
@@ -0,0 +1,119 @@
+#include <chrono>
+#include "catch2/catch.hpp"
+#include "helpers/population_helper.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cpga/operators/roulette_wheel_survival_selection.hpp>
+
+namespace {
+/*
+ * The former selection, which scanned the pool on every spin and erased each
+ * survivor from it, kept to compare against in the benchmark below
+ */
+void quadratic_survival_selection(cpga::population<int, int> &parents,
+                                  cpga::population<int, int> &offspring,
+                                  std::default_random_engine &generator) {
+  std::uniform_real_distribution<double> distribution{0.0, 1.0};
+  auto survivors_num = parents.size();
+
+  parents.insert(parents.end(), std::begin(offspring), std::end(offspring));
+  offspring.clear();
+
+  auto total = std::accumulate(std::begin(parents),
+                               std::end(parents),
+                               0,
+                               [](auto acc, const auto &m) { return acc + m.second; });
+
+  for (size_t i = 0; i < survivors_num; ++i) {
+    auto rand_fitness{distribution(generator) * total};
+    size_t survivor{0};
+    while (survivor + 1 < parents.size() && rand_fitness >= parents[survivor].second) {
+      rand_fitness -= parents[survivor++].second;
+    }
+
+    total -= parents[survivor].second;
+    offspring.emplace_back(parents[survivor]);
+    parents.erase(parents.begin() + survivor);
+  }
+}
+}
+
+TEST_CASE("roulette_wheel_survival_selection exhibits correct behaviour", "[roulette_wheel_survival_selection]") {
+  auto config = shared_config_builder(cpga::pga_model::GLOBAL).build();
+
+  cpga::operators::roulette_wheel_survival_selection<int, int> selection{config, cpga::island_0};
+
+  SECTION("when survivors are drawn without replacement") {
+    cpga::population<int, int> parents{population_helper::sample_population(20)};
+    cpga::population<int, int> offspring{population_helper::sample_population(40)};
+
+    for (auto &child : offspring) {
+      child.first += 20;
+    }
+
+    selection(parents, offspring);
+
+    std::vector<int> survivors;
+    std::transform(std::begin(offspring), std::end(offspring), std::back_inserter(survivors), [](const auto &m) {
+      return m.first;
+    });
+    std::sort(std::begin(survivors), std::end(survivors));
+
+    REQUIRE(offspring.size() == 20);
+    REQUIRE(parents.empty());
+    REQUIRE(std::adjacent_find(std::begin(survivors), std::end(survivors)) == std::end(survivors));
+  }
+
+  SECTION("when members of zero fitness value never survive before others") {
+    cpga::population<int, int> parents{{1, 0}, {2, 5}, {3, 0}};
+    cpga::population<int, int> offspring{{4, 0}, {5, 7}, {6, 1}};
+
+    selection(parents, offspring);
+
+    std::vector<int> survivors;
+    std::transform(std::begin(offspring), std::end(offspring), std::back_inserter(survivors), [](const auto &m) {
+      return m.first;
+    });
+    std::sort(std::begin(survivors), std::end(survivors));
+
+    REQUIRE(survivors == std::vector<int>{2, 5, 6});
+  }
+
+  SECTION("when only members of zero fitness value are left") {
+    cpga::population<int, int> parents{{1, 0}, {2, 3}};
+    cpga::population<int, int> offspring{{3, 0}};
+
+    selection(parents, offspring);
+
+    REQUIRE(offspring == cpga::population<int, int>{{2, 3}, {1, 0}});
+  }
+}
+
+TEST_CASE("roulette_wheel_survival_selection benchmark", "[roulette_wheel_survival_selection][.benchmark]") {
+  using clock = std::chrono::high_resolution_clock;
+
+  auto config = shared_config_builder(cpga::pga_model::GLOBAL).build();
+
+  cpga::operators::roulette_wheel_survival_selection<int, int> selection{config, cpga::island_0};
+  std::default_random_engine generator;
+
+  for (size_t size : {1000, 5000, 20000}) {
+    auto parents = population_helper::sample_population(size);
+    auto offspring = population_helper::sample_population(size);
+    auto reference_parents = parents;
+    auto reference_offspring = offspring;
+
+    auto start = clock::now();
+    selection(parents, offspring);
+    auto fenwick = clock::now() - start;
+
+    start = clock::now();
+    quadratic_survival_selection(reference_parents, reference_offspring, generator);
+    auto quadratic = clock::now() - start;
+
+    WARN("Population " << size << ": fenwick_tree "
+                       << std::chrono::duration_cast<std::chrono::microseconds>(fenwick).count() << " us, quadratic "
+                       << std::chrono::duration_cast<std::chrono::microseconds>(quadratic).count() << " us");
+
+    REQUIRE(offspring.size() == reference_offspring.size());
+  }
+}
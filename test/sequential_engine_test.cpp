@@ -0,0 +1,121 @@
+#include "catch2/catch.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cpga/models/sequential_engine.hpp>
+#include <cpga/operators/roulette_wheel_parent_selection.hpp>
+#include <cpga/operators/sequence_individual_crossover.hpp>
+#include <cpga/operators/sequence_individual_initialization.hpp>
+#include <cpga/examples/onemax/bitstring_mutation.hpp>
+#include <cpga/examples/onemax/onemax_fitness_evaluation.hpp>
+
+namespace {
+using bitstring = std::vector<char>;
+
+struct counting_reporting {
+  size_t *started;
+  size_t *finished;
+  size_t *generations;
+
+  void evolution_started() const noexcept {
+  }
+
+  void generation_started() const noexcept {
+    ++*started;
+  }
+
+  void generation_finished(size_t generation) const noexcept {
+    ++*finished;
+  }
+
+  void evolution_finished(size_t generations, const cpga::population<bitstring, int> &main) const noexcept {
+    *this->generations = generations;
+  }
+};
+
+// Holds from the given call on
+template<size_t holding_call>
+struct nth_call_check : cpga::core::base_operator {
+  using base_operator::base_operator;
+
+  size_t calls{0};
+
+  bool operator()(const cpga::population<bitstring, int> &population) noexcept {
+    return ++calls >= holding_call;
+  }
+};
+
+template<typename global_termination_check = cpga::core::default_global_termination_check<bitstring, int>,
+    typename reporting_policy = cpga::models::silent_reporting<bitstring, int>>
+using onemax_engine = cpga::models::sequential_engine<bitstring, int,
+                                                      cpga::examples::onemax_fitness_evaluation,
+                                                      cpga::operators::sequence_individual_initialization<char, int>,
+                                                      cpga::operators::sequence_individual_crossover<char, int>,
+                                                      cpga::examples::bitstring_mutation,
+                                                      cpga::operators::roulette_wheel_parent_selection<bitstring, int>,
+                                                      cpga::core::default_survival_selection_operator<bitstring, int>,
+                                                      cpga::core::default_elitism_operator<bitstring, int>,
+                                                      global_termination_check,
+                                                      reporting_policy>;
+}
+
+TEST_CASE("sequential_engine exhibits correct behaviour", "[sequential_engine]") {
+  std::vector<char> constituents{0, 1};
+
+  auto config = shared_config_builder(cpga::pga_model::SEQUENTIAL)
+      .withPopulationSize(20)
+      .withIndividualSize(8)
+      .withGenerationsNumber(10)
+      .withElitistsNumber(0)
+      .withElitism(false)
+      .withSurvivalSelection(false)
+      .repeatingIndividualElements(true)
+      .withUserProperty(cpga::strings::POSSIBLE_VALUES, constituents)
+      .build();
+
+  SECTION("when run for all generations") {
+    size_t started = 0, finished = 0, generations = 0;
+
+    onemax_engine<cpga::core::default_global_termination_check<bitstring, int>, counting_reporting> engine{
+        config, counting_reporting{&started, &finished, &generations}};
+
+    auto main = engine.run();
+
+    REQUIRE(main.size() == config->system_props.population_size);
+    REQUIRE(std::all_of(std::begin(main), std::end(main), [](const auto &member) {
+      return member.first.size() == 8
+          && member.second == std::count(std::begin(member.first), std::end(member.first), 1);
+    }));
+    REQUIRE(engine.generations() == 10);
+    REQUIRE(started == 10);
+    REQUIRE(finished == 10);
+    REQUIRE(generations == 10);
+  }
+
+  SECTION("when the termination check holds after the first generation") {
+    size_t started = 0, finished = 0, generations = 0;
+
+    onemax_engine<nth_call_check<1>, counting_reporting> engine{
+        config, counting_reporting{&started, &finished, &generations}};
+
+    auto main = engine.run();
+
+    REQUIRE(main.size() == config->system_props.population_size);
+    REQUIRE(engine.generations() == 1);
+    REQUIRE(started == 1);
+    REQUIRE(finished == 1);
+    REQUIRE(generations == 1);
+  }
+
+  SECTION("when the termination check holds after a few generations") {
+    size_t started = 0, finished = 0, generations = 0;
+
+    onemax_engine<nth_call_check<3>, counting_reporting> engine{
+        config, counting_reporting{&started, &finished, &generations}};
+
+    engine.run();
+
+    REQUIRE(engine.generations() == 3);
+    REQUIRE(started == 3);
+    REQUIRE(finished == 3);
+    REQUIRE(generations == 3);
+  }
+}
@@ -0,0 +1,95 @@
+#include "catch2/catch.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cpga/operators/stochastic_universal_sampling_parent_selection.hpp>
+
+TEST_CASE("stochastic_universal_sampling_parent_selection exhibits correct behaviour",
+          "[stochastic_universal_sampling_parent_selection]") {
+  using selection_type = cpga::operators::stochastic_universal_sampling_parent_selection<int, int>;
+
+  auto config = shared_config_builder(cpga::pga_model::GLOBAL).build();
+
+  selection_type selection{config, cpga::island_0};
+
+  // The number of times each member is chosen
+  auto counts = [](const cpga::population<int, int> &main, const std::vector<size_t> &chosen) {
+    std::vector<size_t> counts(main.size(), 0);
+    for (auto i : chosen) {
+      ++counts[i];
+    }
+    return counts;
+  };
+
+  SECTION("when members are chosen within one of their expected number of times") {
+    cpga::population<int, int> main{{1, 7}, {2, 0}, {3, 13}, {4, 1}, {5, 29}, {6, 0}, {7, 4}, {8, 46}};
+    auto total = 100.0;
+    std::default_random_engine generator{7};
+    std::uniform_real_distribution<double> distribution{0.0, 1.0};
+
+    for (size_t count : {2, 8, 10, 33, 100}) {
+      size_t violations{0};
+
+      for (int spin = 0; spin < 1000; ++spin) {
+        auto chosen = selection_type::sample(main, count, distribution(generator));
+        auto chosen_counts = counts(main, chosen);
+
+        REQUIRE(chosen.size() == count);
+
+        for (size_t i = 0; i < main.size(); ++i) {
+          auto expected = count * main[i].second / total;
+
+          violations += chosen_counts[i] < std::floor(expected) || chosen_counts[i] > std::ceil(expected);
+        }
+      }
+
+      REQUIRE(violations == 0);
+    }
+  }
+
+  SECTION("when the total fitness value is zero every member is given the same share") {
+    cpga::population<int, int> main{{1, 0}, {2, 0}, {3, 0}, {4, 0}};
+
+    for (double offset : {0.0, 0.5, 0.99}) {
+      REQUIRE(counts(main, selection_type::sample(main, 4, offset)) == std::vector<size_t>{1, 1, 1, 1});
+      auto two = counts(main, selection_type::sample(main, 2, offset));
+      REQUIRE(std::all_of(std::begin(two), std::end(two), [](auto count) { return count <= 1; }));
+    }
+
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    std::vector<size_t> chosen;
+    for (const auto &couple : couples) {
+      chosen.push_back(couple.first.first - 1);
+      chosen.push_back(couple.second.first - 1);
+    }
+
+    REQUIRE(couples.size() == 2);
+    REQUIRE(counts(main, chosen) == std::vector<size_t>{1, 1, 1, 1});
+  }
+
+  SECTION("when couples are made of the chosen members") {
+    cpga::population<int, int> main{{1, 2}, {2, 2}, {3, 2}, {4, 2}, {5, 2}, {6, 2}};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    std::vector<size_t> chosen;
+    for (const auto &couple : couples) {
+      chosen.push_back(couple.first.first - 1);
+      chosen.push_back(couple.second.first - 1);
+    }
+
+    REQUIRE(couples.size() == 3);
+    REQUIRE(counts(main, chosen) == std::vector<size_t>(6, 1));
+  }
+
+  SECTION("when the population is too small") {
+    cpga::population<int, int> main{{1, 1}};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.empty());
+  }
+}
@@ -0,0 +1,137 @@
+#include "catch2/catch.hpp"
+#include "helpers/population_helper.hpp"
+#include "helpers/shared_config_builder.hpp"
+#include <cmath>
+#include <cpga/operators/tournament_parent_selection.hpp>
+#include <cpga/operators/tournament_survival_selection.hpp>
+
+namespace {
+const size_t draws{20000};
+
+// The chance that the member of the given rank, counted from the worst one, wins a tournament of the given size
+// among size members when contenders are drawn with replacement
+double win_chance(size_t rank, size_t size, size_t tournament_size) {
+  return (std::pow(rank + 1.0, tournament_size) - std::pow(rank, tournament_size)) / std::pow(size, tournament_size);
+}
+
+cpga::core::shared_config make_config(size_t tournament_size) {
+  return shared_config_builder(cpga::pga_model::GLOBAL)
+      .withUserProperty(cpga::strings::TOURNAMENT_SIZE, tournament_size)
+      .build();
+}
+}
+
+TEST_CASE("tournament_parent_selection exhibits correct behaviour", "[tournament_parent_selection]") {
+  SECTION("when members win as often as the tournament size makes them") {
+    // Every fitness value is the rank of its member
+    cpga::population<int, int> main{{0, 3}, {1, 0}, {2, 2}, {3, 1}};
+
+    for (size_t tournament_size : {1, 2, 3}) {
+      cpga::operators::tournament_parent_selection<int, int> selection{make_config(tournament_size), cpga::island_0};
+      std::vector<size_t> wins(main.size(), 0);
+
+      for (size_t i = 0; i < draws / 2; ++i) {
+        cpga::couples<int, int> couples;
+
+        selection(main, couples);
+
+        for (const auto &couple : couples) {
+          ++wins[couple.first.second];
+        }
+      }
+
+      for (size_t rank = 0; rank < main.size(); ++rank) {
+        REQUIRE(wins[rank] / static_cast<double>(draws) == Approx(win_chance(rank, main.size(), tournament_size))
+            .margin(0.02));
+      }
+    }
+  }
+
+  SECTION("when the tournament is large enough to always pick the best member") {
+    cpga::operators::tournament_parent_selection<int, int> selection{make_config(100), cpga::island_0};
+    cpga::population<int, int> main{{1, -5}, {2, -1}, {3, -3}, {4, -2}};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.size() == 2);
+    REQUIRE(std::all_of(std::begin(couples), std::end(couples), [](const auto &couple) {
+      return couple.first.first == 2 && couple.second.first == 3;
+    }));
+  }
+
+  SECTION("when fitness values are minimized") {
+    cpga::operators::tournament_parent_selection<int, int, std::greater<int>> selection{make_config(100),
+                                                                                        cpga::island_0};
+    cpga::population<int, int> main{{1, -5}, {2, -1}, {3, -3}, {4, -2}};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.size() == 2);
+    REQUIRE(std::all_of(std::begin(couples), std::end(couples), [](const auto &couple) {
+      return couple.first.first == 1 && couple.second.first == 2;
+    }));
+  }
+
+  SECTION("with the default tournament size") {
+    auto default_config = shared_config_builder(cpga::pga_model::GLOBAL).build();
+
+    cpga::operators::tournament_parent_selection<int, int> selection{default_config, cpga::island_0};
+    cpga::population<int, int> main{population_helper::sample_population(21)};
+    cpga::couples<int, int> couples;
+
+    selection(main, couples);
+
+    REQUIRE(couples.size() == 10);
+  }
+}
+
+TEST_CASE("tournament_survival_selection exhibits correct behaviour", "[tournament_survival_selection]") {
+  SECTION("when members survive as often as the tournament size makes them") {
+    for (size_t tournament_size : {1, 3}) {
+      cpga::operators::tournament_survival_selection<int, int> selection{make_config(tournament_size),
+                                                                         cpga::island_0};
+      std::vector<size_t> wins(4, 0);
+      size_t mismatches{0};
+
+      for (size_t i = 0; i < draws; ++i) {
+        // A single parent leaves a single survivor, every fitness value is the rank of its member
+        cpga::population<int, int> parents{{0, 2}};
+        cpga::population<int, int> offspring{{1, 0}, {2, 3}, {3, 1}};
+
+        selection(parents, offspring);
+
+        mismatches += offspring.size() != 1;
+        ++wins[offspring.front().second];
+      }
+
+      REQUIRE(mismatches == 0);
+
+      for (size_t rank = 0; rank < wins.size(); ++rank) {
+        REQUIRE(wins[rank] / static_cast<double>(draws) == Approx(win_chance(rank, wins.size(), tournament_size))
+            .margin(0.02));
+      }
+    }
+  }
+
+  SECTION("when the tournament is large enough to always pick the best member left") {
+    cpga::operators::tournament_survival_selection<int, int> selection{make_config(1000), cpga::island_0};
+    cpga::population<int, int> parents{population_helper::sample_population(10)};
+    cpga::population<int, int> offspring{population_helper::sample_population(10)};
+
+    for (auto &child : offspring) {
+      child.first += 10;
+      child.second = -child.second;
+    }
+
+    selection(parents, offspring);
+
+    cpga::population<int, int> expected{
+        {10, 20}, {9, 18}, {8, 16}, {7, 14}, {6, 12}, {5, 10}, {4, 8}, {3, 6}, {2, 4}, {1, 2}
+    };
+
+    REQUIRE(parents.empty());
+    REQUIRE(offspring == expected);
+  }
+}